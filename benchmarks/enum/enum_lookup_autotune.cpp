@@ -0,0 +1,561 @@
+/**
+ * Measures every enum lookup strategy over synthetic enum types on the host
+ * CPU and emits a header of REFLECT_CPP26_ENUM_* threshold overrides, which
+ * can be checked in per deployment target and included (or passed with
+ * -include) before any header of reflect_cpp26.
+ *
+ * Usage: enum_lookup_autotune [output-header-path]
+ * The header is written to stdout if no path is given. Measurements are
+ * reported to stderr.
+ *
+ * Synthetic enum types vary in:
+ *   - size: 2^2, 2^3, ..., 2^8 entries;
+ *   - density: values are 0, s, 2s, ... with stride s (value lookup);
+ *   - name length: "<prefix><binary digits>" with a short or long common
+ *     prefix (name lookup). All names of an enum type are of the same length,
+ *     which is the worst case of char dispatch;
+ *   - minimum load factor of hash tables: 1, 1/2 and 1/4 (name lookup with
+ *     hash table, with fallback if the table fails to build).
+ * Each strategy is forced with annotations (see
+ * annotations/enum_properties.hpp) except char dispatch, which is taken by
+ * automatic name search since its threshold is lifted below. The path
+ * actually taken is checked with enum_lookup_stats for every type (except
+ * in the load factor sweep), since a strategy whose table fails to build
+ * falls back silently.
+ */
+#undef REFLECT_CPP26_ENUM_DISABLE_CHAR_DISPATCH_THRESHOLD
+#define REFLECT_CPP26_ENUM_DISABLE_CHAR_DISPATCH_THRESHOLD (1zU << 16)
+
+#include "benchmarks/enum/synthetic_enums.hpp"
+#include <reflect_cpp26/annotations/enum_properties.hpp>
+#include <reflect_cpp26/annotations/macros.h>
+#include <reflect_cpp26/enum/enum_cast.hpp>
+#include <reflect_cpp26/enum/enum_contains.hpp>
+#include <reflect_cpp26/enum/enum_lookup_stats.hpp>
+#include <reflect_cpp26/enum/enum_names.hpp>
+#include <reflect_cpp26/enum/enum_values.hpp>
+#include <reflect_cpp26/utils/expand.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#define RFL_PROPERTY(...) REFLECT_CPP26_PROPERTY(__VA_ARGS__)
+
+using namespace reflect_cpp26;
+using value_search = annotations::enum_value_search_strategy;
+using name_search = annotations::enum_name_search_strategy;
+
+// ---- Synthetic enum types ----
+
+constexpr size_t min_level = 2;
+constexpr size_t max_level = 8;
+constexpr size_t level_count = max_level - min_level + 1;
+
+constexpr size_t value_strides[] = {1, 2, 4, 8, 32};
+constexpr size_t stride_count = std::size(value_strides);
+constexpr value_search value_strategies[] = {
+  value_search::linear_search,
+  value_search::binary_search,
+  value_search::slot_table,
+};
+constexpr size_t value_strategy_count = std::size(value_strategies);
+
+// automatic is char dispatch (see above)
+constexpr name_search name_strategies[] = {
+  name_search::automatic,
+  name_search::linear_search,
+  name_search::binary_search,
+  name_search::hash_table,
+  name_search::perfect_hash,
+};
+constexpr size_t name_strategy_count = std::size(name_strategies);
+constexpr size_t name_length_count = 2; // Short and long prefixes
+
+// Candidates of REFLECT_CPP26_ENUM_HASH_INV_MIN_LOAD_FACTOR
+constexpr size_t inv_load_factors[] = {1, 2, 4};
+constexpr size_t load_factor_count = std::size(inv_load_factors);
+
+template <size_t Stride, size_t Level, value_search Strategy>
+struct value_enum;
+
+template <bool LongName, size_t Level, name_search Strategy>
+struct name_enum;
+
+template <bool LongName, size_t Level, size_t InvLoadFactor>
+struct load_factor_enum;
+
+#define VALUE_ENUM(S, K, Strategy)                                      \
+  template <>                                                           \
+  struct value_enum<S, K, value_search::Strategy> {                     \
+    enum class RFL_PROPERTY(enum_value_search, value_search::Strategy)  \
+    type: int32_t {                                                     \
+      SYN_L##K(SYN_STRIDE_##S, e_, 0)                                   \
+    };                                                                  \
+  };                                                                    \
+  static_assert(enum_lookup_stats<                                      \
+    value_enum<S, K, value_search::Strategy>::type>().value_lookup      \
+      == enum_value_lookup_kind::Strategy);
+
+#define VALUE_ENUMS(S, Strategy)                                        \
+  VALUE_ENUM(S, 2, Strategy) VALUE_ENUM(S, 3, Strategy)                 \
+  VALUE_ENUM(S, 4, Strategy) VALUE_ENUM(S, 5, Strategy)                 \
+  VALUE_ENUM(S, 6, Strategy) VALUE_ENUM(S, 7, Strategy)                 \
+  VALUE_ENUM(S, 8, Strategy)
+
+#define VALUE_ENUMS_ALL(S)                                              \
+  VALUE_ENUMS(S, linear_search)                                         \
+  VALUE_ENUMS(S, binary_search)                                         \
+  VALUE_ENUMS(S, slot_table)
+
+// Expected: enum_name_lookup_kind taken by Strategy
+#define NAME_ENUM(LongName, Prefix, K, Strategy, Expected)              \
+  template <>                                                           \
+  struct name_enum<LongName, K, name_search::Strategy> {                \
+    enum class RFL_PROPERTY(enum_name_search, name_search::Strategy)    \
+    type: int32_t {                                                     \
+      SYN_L##K(SYN_STRIDE_1, Prefix, 0)                                 \
+    };                                                                  \
+  };                                                                    \
+  static_assert(enum_lookup_stats<                                      \
+    name_enum<LongName, K, name_search::Strategy>::type>().name_lookup  \
+      == enum_name_lookup_kind::Expected);
+
+#define NAME_ENUMS(LongName, Prefix, Strategy, Expected)                \
+  NAME_ENUM(LongName, Prefix, 2, Strategy, Expected)                    \
+  NAME_ENUM(LongName, Prefix, 3, Strategy, Expected)                    \
+  NAME_ENUM(LongName, Prefix, 4, Strategy, Expected)                    \
+  NAME_ENUM(LongName, Prefix, 5, Strategy, Expected)                    \
+  NAME_ENUM(LongName, Prefix, 6, Strategy, Expected)                    \
+  NAME_ENUM(LongName, Prefix, 7, Strategy, Expected)                    \
+  NAME_ENUM(LongName, Prefix, 8, Strategy, Expected)
+
+#define NAME_ENUMS_ALL(LongName, Prefix)                                \
+  NAME_ENUMS(LongName, Prefix, automatic, char_dispatch)                \
+  NAME_ENUMS(LongName, Prefix, linear_search, linear_search)            \
+  NAME_ENUMS(LongName, Prefix, binary_search, binary_search)            \
+  NAME_ENUMS(LongName, Prefix, hash_table, hash_table)                  \
+  NAME_ENUMS(LongName, Prefix, perfect_hash, perfect_hash)
+
+// Hash table may fail to build with high load factor, in which case the
+// cost of fallback is measured as is (and reported), since that is what
+// the load factor leads to.
+#define LOAD_FACTOR_ENUM(LongName, Prefix, K, Inv)                      \
+  template <>                                                           \
+  struct load_factor_enum<LongName, K, Inv> {                           \
+    enum class RFL_PROPERTY(enum_name_search, name_search::hash_table)  \
+      RFL_PROPERTY(enum_hash_min_load_factor, 1.0 / (Inv))              \
+    type: int32_t {                                                     \
+      SYN_L##K(SYN_STRIDE_1, Prefix, 0)                                 \
+    };                                                                  \
+  };
+
+#define LOAD_FACTOR_ENUMS(LongName, Prefix, Inv)                        \
+  LOAD_FACTOR_ENUM(LongName, Prefix, 2, Inv)                            \
+  LOAD_FACTOR_ENUM(LongName, Prefix, 3, Inv)                            \
+  LOAD_FACTOR_ENUM(LongName, Prefix, 4, Inv)                            \
+  LOAD_FACTOR_ENUM(LongName, Prefix, 5, Inv)                            \
+  LOAD_FACTOR_ENUM(LongName, Prefix, 6, Inv)                            \
+  LOAD_FACTOR_ENUM(LongName, Prefix, 7, Inv)                            \
+  LOAD_FACTOR_ENUM(LongName, Prefix, 8, Inv)
+
+#define LOAD_FACTOR_ENUMS_ALL(LongName, Prefix)                         \
+  LOAD_FACTOR_ENUMS(LongName, Prefix, 1)                                \
+  LOAD_FACTOR_ENUMS(LongName, Prefix, 2)                                \
+  LOAD_FACTOR_ENUMS(LongName, Prefix, 4)
+
+VALUE_ENUMS_ALL(1)
+VALUE_ENUMS_ALL(2)
+VALUE_ENUMS_ALL(4)
+VALUE_ENUMS_ALL(8)
+VALUE_ENUMS_ALL(32)
+
+NAME_ENUMS_ALL(false, e_)
+NAME_ENUMS_ALL(true, enumerator_with_a_fairly_long_common_name_prefix_)
+
+LOAD_FACTOR_ENUMS_ALL(false, e_)
+LOAD_FACTOR_ENUMS_ALL(
+  true, enumerator_with_a_fairly_long_common_name_prefix_)
+
+// ---- Measurement ----
+
+constexpr size_t query_count = 4096;
+constexpr size_t repeat_count = 64;
+constexpr size_t round_count = 7;
+constexpr uint64_t query_seed = 20250101;
+
+volatile size_t sink;
+
+// Minimum nanoseconds per query among all rounds.
+template <class Func>
+auto measure_ns_per_query(const Func& run_queries) -> double
+{
+  auto best = std::numeric_limits<double>::max();
+  for (auto r = 0zU; r < round_count; r++) {
+    auto start = std::chrono::steady_clock::now();
+    auto hit_count = 0zU;
+    for (auto i = 0zU; i < repeat_count; i++) {
+      hit_count += run_queries();
+    }
+    auto stop = std::chrono::steady_clock::now();
+    sink = hit_count;
+    auto ns = std::chrono::duration<double, std::nano>(stop - start).count();
+    best = std::min(best, ns / (repeat_count * query_count));
+  }
+  return best;
+}
+
+// 3 of 4 queries hit. Misses are either between entries or out of range.
+template <class E>
+auto measure_value_lookup() -> double
+{
+  auto rng = std::mt19937_64{query_seed};
+  auto values = enum_values<E>();
+  auto queries = std::vector<E>(query_count);
+  for (auto& q: queries) {
+    auto v = std::to_underlying(values[rng() % values.size()]);
+    if (rng() % 4 == 0) {
+      v = enum_contains<E>(v + 1) ? -1 - v : v + 1;
+    }
+    q = static_cast<E>(v);
+  }
+  return measure_ns_per_query([&queries]() {
+    auto hit_count = 0zU;
+    for (auto q: queries) {
+      hit_count += enum_contains(q);
+    }
+    return hit_count;
+  });
+}
+
+// 3 of 4 queries hit. Misses differ from some name in the last character.
+template <class E>
+auto measure_name_lookup() -> double
+{
+  auto rng = std::mt19937_64{query_seed};
+  auto names = enum_names<E>();
+  auto query_strings = std::vector<std::string>(query_count);
+  for (auto& q: query_strings) {
+    q = names[rng() % names.size()];
+    if (rng() % 4 == 0) {
+      q.back() = 'x';
+    }
+  }
+  auto queries = std::vector<std::string_view>(
+    query_strings.begin(), query_strings.end());
+  return measure_ns_per_query([&queries]() {
+    auto hit_count = 0zU;
+    for (auto q: queries) {
+      hit_count += enum_cast<E>(q).has_value();
+    }
+    return hit_count;
+  });
+}
+
+// ns[stride][level][strategy]
+using value_results = std::array<std::array<
+  std::array<double, value_strategy_count>, level_count>, stride_count>;
+// ns[name length][level][strategy]
+using name_results = std::array<std::array<
+  std::array<double, name_strategy_count>, level_count>, name_length_count>;
+// [name length][level][load factor candidate]
+using load_factor_array = std::array<std::array<
+  std::array<double, load_factor_count>, level_count>, name_length_count>;
+
+struct load_factor_results {
+  load_factor_array ns;
+  load_factor_array actual; // Load factor of hash table, or 0 on fallback
+};
+
+auto measure_all_value_lookups() -> value_results
+{
+  auto res = value_results{};
+  REFLECT_CPP26_EXPAND_I(stride_count).for_each([&res](auto S) {
+    REFLECT_CPP26_EXPAND_I(level_count).for_each([&res](auto K) {
+      REFLECT_CPP26_EXPAND_I(value_strategy_count).for_each([&res](auto T) {
+        constexpr auto s = decltype(S)::value;
+        constexpr auto k = decltype(K)::value;
+        constexpr auto t = decltype(T)::value;
+        using E = value_enum<value_strides[s], min_level + k,
+                             value_strategies[t]>::type;
+        res[s][k][t] = measure_value_lookup<E>();
+      });
+    });
+  });
+  return res;
+}
+
+auto measure_all_name_lookups() -> name_results
+{
+  auto res = name_results{};
+  REFLECT_CPP26_EXPAND_I(name_length_count).for_each([&res](auto L) {
+    REFLECT_CPP26_EXPAND_I(level_count).for_each([&res](auto K) {
+      REFLECT_CPP26_EXPAND_I(name_strategy_count).for_each([&res](auto T) {
+        constexpr auto l = decltype(L)::value;
+        constexpr auto k = decltype(K)::value;
+        constexpr auto t = decltype(T)::value;
+        using E = name_enum<l == 1, min_level + k, name_strategies[t]>::type;
+        res[l][k][t] = measure_name_lookup<E>();
+      });
+    });
+  });
+  return res;
+}
+
+auto measure_all_load_factors() -> load_factor_results
+{
+  auto res = load_factor_results{};
+  REFLECT_CPP26_EXPAND_I(name_length_count).for_each([&res](auto L) {
+    REFLECT_CPP26_EXPAND_I(level_count).for_each([&res](auto K) {
+      REFLECT_CPP26_EXPAND_I(load_factor_count).for_each([&res](auto F) {
+        constexpr auto l = decltype(L)::value;
+        constexpr auto k = decltype(K)::value;
+        constexpr auto f = decltype(F)::value;
+        using E = load_factor_enum<l == 1, min_level + k,
+                                   inv_load_factors[f]>::type;
+        res.ns[l][k][f] = measure_name_lookup<E>();
+        res.actual[l][k][f] = enum_lookup_stats<E>().hash_load_factor;
+      });
+    });
+  });
+  return res;
+}
+
+// ---- Threshold selection ----
+
+constexpr auto level_size(size_t k) -> size_t {
+  return size_t{1} << (min_level + k);
+}
+
+// Used if the faster strategy does not take over within measured sizes.
+constexpr size_t beyond_measured_size = size_t{2} << max_level;
+
+/**
+ * Smallest measured size from which cost of strategy b is no more than
+ * strategy a for all larger measured sizes, or beyond_measured_size if none.
+ */
+auto find_crossover(const std::array<double, level_count>& a,
+                    const std::array<double, level_count>& b) -> size_t
+{
+  auto res = beyond_measured_size;
+  for (auto k = level_count; k-- > 0; ) {
+    if (b[k] > a[k]) {
+      break;
+    }
+    res = level_size(k);
+  }
+  return res;
+}
+
+struct threshold_entry {
+  const char* macro;
+  size_t value;
+  std::string comment;
+};
+
+auto select_thresholds(const value_results& vr, const name_results& nr,
+                       const load_factor_results& lr)
+  -> std::vector<threshold_entry>
+{
+  enum { v_linear, v_binary, v_slot };
+  enum { n_char, n_linear, n_binary, n_hash, n_perfect };
+  // Costs summed over densities or name lengths, ns per query
+  auto value_cost = [&vr](size_t t) {
+    auto res = std::array<double, level_count>{};
+    for (auto k = 0zU; k < level_count; k++) {
+      for (auto s = 0zU; s < stride_count; s++) {
+        res[k] += vr[s][k][t];
+      }
+    }
+    return res;
+  };
+  auto name_cost = [&nr](size_t t) {
+    auto res = std::array<double, level_count>{};
+    for (auto k = 0zU; k < level_count; k++) {
+      for (auto l = 0zU; l < name_length_count; l++) {
+        res[k] += nr[l][k][t];
+      }
+    }
+    return res;
+  };
+  auto min_of = [](const auto& a, const auto& b) {
+    auto res = a;
+    for (auto k = 0zU; k < level_count; k++) {
+      res[k] = std::min(a[k], b[k]);
+    }
+    return res;
+  };
+  auto sum_of = [](const auto& a, const auto& b) {
+    auto res = a;
+    for (auto k = 0zU; k < level_count; k++) {
+      res[k] += b[k];
+    }
+    return res;
+  };
+
+  auto res = std::vector<threshold_entry>{};
+  // Binary search threshold is shared by value and name lookup.
+  auto linear = sum_of(value_cost(v_linear), name_cost(n_linear));
+  auto binary = sum_of(value_cost(v_binary), name_cost(n_binary));
+  res.push_back({"REFLECT_CPP26_ENUM_ENABLE_BINARY_SEARCH_THRESHOLD",
+    find_crossover(linear, binary),
+    "Binary search is faster than linear search from this size"});
+
+  // Largest stride whose slot table wins at every size, with all denser ones
+  auto span_ratio = 1zU;
+  for (auto s = 0zU; s < stride_count; s++) {
+    auto wins = true;
+    for (auto k = 0zU; k < level_count; k++) {
+      auto other = std::min(vr[s][k][v_linear], vr[s][k][v_binary]);
+      wins &= (vr[s][k][v_slot] <= other);
+    }
+    if (!wins) {
+      break;
+    }
+    span_ratio = value_strides[s];
+  }
+  res.push_back({"REFLECT_CPP26_ENUM_VALUE_SLOT_TABLE_MAX_SPAN_RATIO",
+    span_ratio, "Slot table is faster than searching up to this sparsity"});
+
+  auto dense = min_of(name_cost(n_linear), name_cost(n_binary));
+  auto hash_or_dense = min_of(dense, name_cost(n_hash));
+  auto best_hashing = min_of(hash_or_dense, name_cost(n_perfect));
+  res.push_back({"REFLECT_CPP26_ENUM_DISABLE_CHAR_DISPATCH_THRESHOLD",
+    find_crossover(name_cost(n_char), best_hashing),
+    "Hashing is faster than char dispatch from this size"});
+  res.push_back({"REFLECT_CPP26_ENUM_ENABLE_HASH_TABLE_LOOKUP_THRESHOLD",
+    find_crossover(dense, name_cost(n_hash)),
+    "Hash table is faster than searching hash values from this size"});
+  auto perfect_hash_threshold =
+    find_crossover(hash_or_dense, name_cost(n_perfect));
+  res.push_back({"REFLECT_CPP26_ENUM_DISABLE_HASH_TABLE_LOOKUP_THRESHOLD",
+    perfect_hash_threshold, "Superseded by perfect hash from this size"});
+  res.push_back({"REFLECT_CPP26_ENUM_ENABLE_PERFECT_HASH_LOOKUP_THRESHOLD",
+    perfect_hash_threshold,
+    "Perfect hash is faster than other strategies from this size"});
+
+  // Load factor with the least cost summed over name lengths and sizes.
+  // Ties are broken by the smaller table.
+  auto best_load_factor = 0zU;
+  auto best_load_factor_cost = std::numeric_limits<double>::max();
+  for (auto f = 0zU; f < load_factor_count; f++) {
+    auto cost = 0.0;
+    for (auto l = 0zU; l < name_length_count; l++) {
+      for (auto k = 0zU; k < level_count; k++) {
+        cost += lr.ns[l][k][f];
+      }
+    }
+    if (cost < best_load_factor_cost) {
+      best_load_factor = f;
+      best_load_factor_cost = cost;
+    }
+  }
+  res.push_back({"REFLECT_CPP26_ENUM_HASH_INV_MIN_LOAD_FACTOR",
+    inv_load_factors[best_load_factor],
+    "Hash table is the fastest with load factor no less than 1/N"});
+
+  for (auto& entry: res) {
+    if (entry.value == beyond_measured_size) {
+      entry.comment += " (not reached up to "
+        + std::to_string(level_size(level_count - 1)) + " entries)";
+    }
+  }
+  return res;
+}
+
+// ---- Output ----
+
+void report(const value_results& vr, const name_results& nr,
+            const load_factor_results& lr)
+{
+  std::fprintf(stderr, "Value lookup (ns per query): "
+                       "stride size linear binary slot_table\n");
+  for (auto s = 0zU; s < stride_count; s++) {
+    for (auto k = 0zU; k < level_count; k++) {
+      std::fprintf(stderr, "  %6zu %4zu %8.2f %8.2f %8.2f\n",
+        value_strides[s], level_size(k),
+        vr[s][k][0], vr[s][k][1], vr[s][k][2]);
+    }
+  }
+  std::fprintf(stderr, "Name lookup (ns per query): name size "
+                       "char_dispatch linear binary hash_table perfect_hash\n");
+  for (auto l = 0zU; l < name_length_count; l++) {
+    for (auto k = 0zU; k < level_count; k++) {
+      std::fprintf(stderr, "  %5s %4zu %8.2f %8.2f %8.2f %8.2f %8.2f\n",
+        l == 0 ? "short" : "long", level_size(k), nr[l][k][0],
+        nr[l][k][1], nr[l][k][2], nr[l][k][3], nr[l][k][4]);
+    }
+  }
+  std::fprintf(stderr, "Hash table by min load factor (ns per query, "
+                       "[actual load factor, 0 on fallback]): name size");
+  for (auto inv: inv_load_factors) {
+    std::fprintf(stderr, " 1/%zu", inv);
+  }
+  std::fprintf(stderr, "\n");
+  for (auto l = 0zU; l < name_length_count; l++) {
+    for (auto k = 0zU; k < level_count; k++) {
+      std::fprintf(stderr, "  %5s %4zu", l == 0 ? "short" : "long",
+                   level_size(k));
+      for (auto f = 0zU; f < load_factor_count; f++) {
+        std::fprintf(stderr, " %8.2f [%.2f]",
+                     lr.ns[l][k][f], lr.actual[l][k][f]);
+      }
+      std::fprintf(stderr, "\n");
+    }
+  }
+}
+
+auto make_header(const std::vector<threshold_entry>& thresholds)
+  -> std::string
+{
+  auto out = std::ostringstream{};
+  out << "// Generated by benchmarks/enum/enum_lookup_autotune.\n"
+      << "// Enum lookup thresholds tuned for the host CPU. Include this file\n"
+      << "// (or pass it with -include) before any header of reflect_cpp26.\n"
+      << "#ifndef REFLECT_CPP26_ENUM_TUNED_THRESHOLDS_H\n"
+      << "#define REFLECT_CPP26_ENUM_TUNED_THRESHOLDS_H\n";
+  for (const auto& [macro, value, comment]: thresholds) {
+    out << "\n// " << comment << "\n"
+        << "#ifndef " << macro << "\n"
+        << "#define " << macro << " " << value << "\n"
+        << "#endif\n";
+  }
+  out << "\n#endif // REFLECT_CPP26_ENUM_TUNED_THRESHOLDS_H\n";
+  return out.str();
+}
+
+int main(int argc, char** argv)
+{
+  if (argc > 2) {
+    std::fprintf(stderr, "Usage: %s [output-header-path]\n", argv[0]);
+    return 1;
+  }
+  auto value_res = measure_all_value_lookups();
+  auto name_res = measure_all_name_lookups();
+  auto load_factor_res = measure_all_load_factors();
+  report(value_res, name_res, load_factor_res);
+
+  auto header = make_header(
+    select_thresholds(value_res, name_res, load_factor_res));
+  if (argc == 1) {
+    std::cout << header;
+    return 0;
+  }
+  auto file = std::ofstream{argv[1]};
+  file << header;
+  if (!file) {
+    std::fprintf(stderr, "Failed to write %s\n", argv[1]);
+    return 1;
+  }
+  std::fprintf(stderr, "Written to %s\n", argv[1]);
+  return 0;
+}
@@ -0,0 +1,216 @@
+/**
+ * Compares dispatch modes of enum_switch over synthetic enum types on the
+ * host CPU:
+ *   - compare chain: enum_for_each with one comparison per enumerator,
+ *     which is how enum_switch was implemented before;
+ *   - switch cases: enum_switch_by_cases, i.e. real switch statements of
+ *     64 cases per page (default below disable_switch_cases_threshold);
+ *   - jump table: enum_switch_thunks_v, i.e. an indirect call through a
+ *     static array of thunks (default from disable_switch_cases_threshold).
+ * Both of the latter include translation from value to index, which is a
+ * subtraction for dense values (stride 1) and a table search otherwise.
+ *
+ * Usage: enum_switch
+ * Measurements are reported to stdout, with the smallest measured size
+ * from which jump table is no slower than switch cases.
+ */
+#include "benchmarks/enum/synthetic_enums.hpp"
+#include <reflect_cpp26/enum/enum_for_each.hpp>
+#include <reflect_cpp26/enum/enum_switch.hpp>
+#include <reflect_cpp26/enum/enum_values.hpp>
+#include <reflect_cpp26/utils/expand.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace reflect_cpp26;
+
+// ---- Synthetic enum types ----
+
+constexpr size_t min_level = 2;
+constexpr size_t max_level = 9;
+constexpr size_t level_count = max_level - min_level + 1;
+
+constexpr size_t value_strides[] = {1, 3};
+constexpr size_t stride_count = std::size(value_strides);
+
+template <size_t Stride, size_t Level>
+struct switch_enum;
+
+#define SWITCH_ENUM(S, K)                                               \
+  template <>                                                           \
+  struct switch_enum<S, K> {                                            \
+    enum class type: int32_t {                                          \
+      SYN_L##K(SYN_STRIDE_##S, e_, 0)                                   \
+    };                                                                  \
+  };
+
+#define SWITCH_ENUMS(S)                                                 \
+  SWITCH_ENUM(S, 2) SWITCH_ENUM(S, 3) SWITCH_ENUM(S, 4)                 \
+  SWITCH_ENUM(S, 5) SWITCH_ENUM(S, 6) SWITCH_ENUM(S, 7)                 \
+  SWITCH_ENUM(S, 8) SWITCH_ENUM(S, 9)
+
+SWITCH_ENUMS(1)
+SWITCH_ENUMS(3)
+
+// ---- Dispatch modes ----
+
+// Distinct per-case results which can be inlined into each case.
+struct case_result_t {
+  static constexpr auto operator()(auto ec) -> int {
+    return std::to_underlying(ec.value) * 7 + 1;
+  }
+};
+
+enum dispatch_mode { compare_chain, switch_cases, jump_table };
+constexpr size_t mode_count = 3;
+constexpr const char* mode_names[] = {
+  "compare_chain", "switch_cases", "jump_table",
+};
+
+template <dispatch_mode Mode, class E>
+auto dispatch(E value) -> int
+{
+  auto func = case_result_t{};
+  if constexpr (Mode == compare_chain) {
+    auto res = -1;
+    enum_for_each<E>([&func, &res, value](auto e) {
+      if (e == value) {
+        res = func(e);
+        return false; // false: Does not continue
+      }
+      return true; // true: Continues
+    });
+    return res;
+  } else {
+    auto index = impl::enum_switch_index(value);
+    if (index == npos) {
+      return -1;
+    }
+    if constexpr (Mode == switch_cases) {
+      return impl::enum_switch_by_cases<int, E, 0>(func, index);
+    } else {
+      return impl::enum_switch_thunks_v<int, E, case_result_t>[index](func);
+    }
+  }
+}
+
+// ---- Measurement ----
+
+constexpr size_t query_count = 4096;
+constexpr size_t repeat_count = 64;
+constexpr size_t round_count = 7;
+constexpr uint64_t query_seed = 20250101;
+
+volatile int sink;
+
+// Minimum nanoseconds per query among all rounds.
+template <class Func>
+auto measure_ns_per_query(const Func& run_queries) -> double
+{
+  auto best = std::numeric_limits<double>::max();
+  for (auto r = 0zU; r < round_count; r++) {
+    auto start = std::chrono::steady_clock::now();
+    auto sum = 0;
+    for (auto i = 0zU; i < repeat_count; i++) {
+      sum += run_queries();
+    }
+    auto stop = std::chrono::steady_clock::now();
+    sink = sum;
+    auto ns = std::chrono::duration<double, std::nano>(stop - start).count();
+    best = std::min(best, ns / (repeat_count * query_count));
+  }
+  return best;
+}
+
+// Uniformly random entries so that branch prediction can not learn the
+// sequence. 1 of 8 queries misses.
+template <dispatch_mode Mode, class E>
+auto measure_dispatch() -> double
+{
+  auto rng = std::mt19937_64{query_seed};
+  auto values = enum_values<E>();
+  auto queries = std::vector<E>(query_count);
+  for (auto& q: queries) {
+    auto v = std::to_underlying(values[rng() % values.size()]);
+    q = static_cast<E>((rng() % 8 == 0) ? -1 - v : v);
+  }
+  return measure_ns_per_query([&queries]() {
+    auto sum = 0;
+    for (auto q: queries) {
+      sum += dispatch<Mode>(q);
+    }
+    return sum;
+  });
+}
+
+// ns[stride][level][mode]
+using dispatch_results = std::array<std::array<
+  std::array<double, mode_count>, level_count>, stride_count>;
+
+auto measure_all_dispatches() -> dispatch_results
+{
+  auto res = dispatch_results{};
+  REFLECT_CPP26_EXPAND_I(stride_count).for_each([&res](auto S) {
+    REFLECT_CPP26_EXPAND_I(level_count).for_each([&res](auto K) {
+      constexpr auto s = decltype(S)::value;
+      constexpr auto k = decltype(K)::value;
+      using E = switch_enum<value_strides[s], min_level + k>::type;
+      res[s][k][compare_chain] = measure_dispatch<compare_chain, E>();
+      res[s][k][switch_cases] = measure_dispatch<switch_cases, E>();
+      res[s][k][jump_table] = measure_dispatch<jump_table, E>();
+    });
+  });
+  return res;
+}
+
+constexpr auto level_size(size_t k) -> size_t {
+  return size_t{1} << (min_level + k);
+}
+
+int main()
+{
+  auto res = measure_all_dispatches();
+  std::printf("Enum switch (ns per query): stride size %s %s %s\n",
+    mode_names[0], mode_names[1], mode_names[2]);
+  for (auto s = 0zU; s < stride_count; s++) {
+    for (auto k = 0zU; k < level_count; k++) {
+      std::printf("  %6zu %4zu %13.2f %12.2f %10.2f\n",
+        value_strides[s], level_size(k),
+        res[s][k][0], res[s][k][1], res[s][k][2]);
+    }
+  }
+
+  // Smallest size from which jump table wins at every larger size,
+  // costs summed over strides
+  auto crossover = 0zU;
+  for (auto k = level_count; k-- > 0; ) {
+    auto cases = 0.0;
+    auto table = 0.0;
+    for (auto s = 0zU; s < stride_count; s++) {
+      cases += res[s][k][switch_cases];
+      table += res[s][k][jump_table];
+    }
+    if (table > cases) {
+      break;
+    }
+    crossover = level_size(k);
+  }
+  if (crossover == 0) {
+    std::printf("Jump table is not faster up to %zu entries "
+                "(REFLECT_CPP26_ENUM_DISABLE_SWITCH_CASES_THRESHOLD = %zu)\n",
+                level_size(level_count - 1),
+                impl::enum_constants::disable_switch_cases_threshold);
+  } else {
+    std::printf("Jump table is no slower from %zu entries "
+                "(REFLECT_CPP26_ENUM_DISABLE_SWITCH_CASES_THRESHOLD = %zu)\n",
+                crossover,
+                impl::enum_constants::disable_switch_cases_threshold);
+  }
+  return 0;
+}
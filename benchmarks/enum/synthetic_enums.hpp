@@ -0,0 +1,24 @@
+#pragma once
+
+// Macros to generate enumerators of synthetic enum types in benchmarks.
+
+// Generates 2^K enumerators P0...0, P0...1, ..., P1...1 (K binary digits)
+// whose indices are 0, 1, ..., 2^K - 1 in order, as M(name, index) each.
+// Distinct macros per level since a macro can not expand itself.
+#define SYN_L1(M, P, I) M(P##0, (I) * 2) M(P##1, (I) * 2 + 1)
+#define SYN_L2(M, P, I) SYN_L1(M, P##0, (I) * 2) SYN_L1(M, P##1, (I) * 2 + 1)
+#define SYN_L3(M, P, I) SYN_L2(M, P##0, (I) * 2) SYN_L2(M, P##1, (I) * 2 + 1)
+#define SYN_L4(M, P, I) SYN_L3(M, P##0, (I) * 2) SYN_L3(M, P##1, (I) * 2 + 1)
+#define SYN_L5(M, P, I) SYN_L4(M, P##0, (I) * 2) SYN_L4(M, P##1, (I) * 2 + 1)
+#define SYN_L6(M, P, I) SYN_L5(M, P##0, (I) * 2) SYN_L5(M, P##1, (I) * 2 + 1)
+#define SYN_L7(M, P, I) SYN_L6(M, P##0, (I) * 2) SYN_L6(M, P##1, (I) * 2 + 1)
+#define SYN_L8(M, P, I) SYN_L7(M, P##0, (I) * 2) SYN_L7(M, P##1, (I) * 2 + 1)
+#define SYN_L9(M, P, I) SYN_L8(M, P##0, (I) * 2) SYN_L8(M, P##1, (I) * 2 + 1)
+
+// Enumerator of value index * S, as M of SYN_L*.
+#define SYN_STRIDE_1(N, I) N = (I),
+#define SYN_STRIDE_2(N, I) N = (I) * 2,
+#define SYN_STRIDE_3(N, I) N = (I) * 3,
+#define SYN_STRIDE_4(N, I) N = (I) * 4,
+#define SYN_STRIDE_8(N, I) N = (I) * 8,
+#define SYN_STRIDE_32(N, I) N = (I) * 32,
@@ -1,6 +1,7 @@
 #ifndef REFLECT_CPP26_ANNOTATIONS_HPP
 #define REFLECT_CPP26_ANNOTATIONS_HPP
 
+#include <reflect_cpp26/annotations/enum_properties.hpp>
 #include <reflect_cpp26/annotations/macros.h>
 #include <reflect_cpp26/annotations/properties.hpp>
 #include <reflect_cpp26/annotations/validators.hpp>
@@ -0,0 +1,101 @@
+#ifndef REFLECT_CPP26_ANNOTATIONS_ENUM_PROPERTIES_HPP
+#define REFLECT_CPP26_ANNOTATIONS_ENUM_PROPERTIES_HPP
+
+#include <reflect_cpp26/annotations/properties.hpp>
+#include <cstdint>
+#include <optional>
+
+namespace reflect_cpp26::annotations {
+/**
+ * Strategy of enum_value_search (enum_name, enum_contains, enum_index, etc.).
+ *   automatic: Chosen by global thresholds (see enum/impl/constants.hpp);
+ *   linear_search: Scans all values. Minimal rodata;
+ *   binary_search: Branchless binary search in Eytzinger layout;
+ *   slot_table: Direct indexing with a table that covers [min, max].
+ */
+enum class enum_value_search_strategy {
+  automatic,
+  linear_search,
+  binary_search,
+  slot_table,
+};
+
+/**
+ * Strategy of enum_hash_search (enum_cast from string, etc.).
+ *   automatic: Chosen by global thresholds (see enum/impl/constants.hpp);
+ *   linear_search: Scans hash values of all names. Minimal rodata;
+ *   binary_search: Binary search among hash values of all names;
+ *   hash_table: Open hash table without collision, whose size is limited by
+ *               enum_hash_min_load_factor;
+ *   perfect_hash: Minimal perfect hash table.
+ * Hash tables fall back to linear or binary search if construction fails.
+ */
+enum class enum_name_search_strategy {
+  automatic,
+  linear_search,
+  binary_search,
+  hash_table,
+  perfect_hash,
+};
+
+struct enum_value_search_t : property_tag_t {
+  enum_value_search_strategy value;
+};
+struct enum_name_search_t : property_tag_t {
+  enum_name_search_strategy value;
+};
+struct enum_hash_min_load_factor_t : property_tag_t {
+  double value;
+};
+struct enum_hash_seed_t : property_tag_t {
+  uint64_t value;
+};
+
+constexpr auto make_enum_value_search =
+  make_property_t<enum_value_search_t>{};
+constexpr auto make_enum_name_search =
+  make_property_t<enum_name_search_t>{};
+constexpr auto make_enum_hash_min_load_factor =
+  make_property_t<enum_hash_min_load_factor_t>{};
+constexpr auto make_enum_hash_seed = make_property_t<enum_hash_seed_t>{};
+
+// Property of enum (or class) type T, which is annotated to its declaration.
+template <class Prop, class T>
+constexpr auto type_property_of_opt()
+  -> std::optional<property_value_type_t<Prop>>
+{
+  constexpr auto meta = impl::find_annotation_of_type(
+    ^^Prop, dealias(^^T));
+  if constexpr (std::meta::info{} == meta) {
+    return std::nullopt;
+  } else {
+    return extract<Prop>(meta).value;
+  }
+}
+
+template <class E>
+constexpr auto enum_value_search_of() -> enum_value_search_strategy
+{
+  return type_property_of_opt<enum_value_search_t, E>()
+    .value_or(enum_value_search_strategy::automatic);
+}
+
+template <class E>
+constexpr auto enum_name_search_of() -> enum_name_search_strategy
+{
+  return type_property_of_opt<enum_name_search_t, E>()
+    .value_or(enum_name_search_strategy::automatic);
+}
+
+template <class E>
+constexpr auto enum_hash_min_load_factor_of() -> std::optional<double> {
+  return type_property_of_opt<enum_hash_min_load_factor_t, E>();
+}
+
+template <class E>
+constexpr auto enum_hash_seed_of() -> std::optional<uint64_t> {
+  return type_property_of_opt<enum_hash_seed_t, E>();
+}
+} // namespace reflect_cpp26::annotations
+
+#endif // REFLECT_CPP26_ANNOTATIONS_ENUM_PROPERTIES_HPP
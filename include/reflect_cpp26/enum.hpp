@@ -2,16 +2,24 @@
 #define REFLECT_CPP26_ENUM_HPP
 
 #include <reflect_cpp26/enum/enum_cast.hpp>
+#include <reflect_cpp26/enum/enum_cast_batch.hpp>
 #include <reflect_cpp26/enum/enum_contains.hpp>
 #include <reflect_cpp26/enum/enum_count.hpp>
 #include <reflect_cpp26/enum/enum_entries.hpp>
+#include <reflect_cpp26/enum/enum_flags.hpp>
 #include <reflect_cpp26/enum/enum_for_each.hpp>
+#include <reflect_cpp26/enum/enum_fusion.hpp>
 #include <reflect_cpp26/enum/enum_hash.hpp>
 #include <reflect_cpp26/enum/enum_index.hpp>
 #include <reflect_cpp26/enum/enum_json.hpp>
+#include <reflect_cpp26/enum/enum_lookup_stats.hpp>
+#include <reflect_cpp26/enum/enum_map.hpp>
 #include <reflect_cpp26/enum/enum_meta_entries.hpp>
 #include <reflect_cpp26/enum/enum_names.hpp>
+#include <reflect_cpp26/enum/enum_parse_prefix.hpp>
+#include <reflect_cpp26/enum/enum_set.hpp>
 #include <reflect_cpp26/enum/enum_switch.hpp>
+#include <reflect_cpp26/enum/enum_to_chars.hpp>
 #include <reflect_cpp26/enum/enum_type_name.hpp>
 #include <reflect_cpp26/enum/enum_values.hpp>
 
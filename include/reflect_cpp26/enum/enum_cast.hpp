@@ -10,14 +10,34 @@ namespace reflect_cpp26 {
 /**
  * Returns the value of enum type E whose name is exactly str,
  * or std::nullopt if such value does not exist in E.
+ * Hash policy is configurable with Hash (see utils/string_hash.hpp).
  */
-template <enum_type E>
+template <enum_type E,
+          string_hash_policy Hash = impl::enum_constants::hash_policy>
 constexpr auto enum_cast(std::string_view str)
   -> std::optional<std::remove_cv_t<E>>
 {
-  auto pos = impl::enum_hash_search<std::remove_cv_t<E>>(str);
-  if (pos != nullptr) {
-    return static_cast<E>(pos->value);
+  auto value = impl::enum_hash_search<std::remove_cv_t<E>, Hash>(str);
+  if (value != nullptr) {
+    return static_cast<E>(*value);
+  }
+  return std::nullopt;
+}
+
+/**
+ * Returns the value of enum type E whose name equals to str with ASCII case
+ * ignored, or std::nullopt if such value does not exist in E.
+ * Compile error if two names of E with different values are equal
+ * with case ignored.
+ */
+template <enum_type E,
+          string_icase_hash_policy Hash = impl::enum_constants::hash_policy>
+constexpr auto enum_cast_icase(std::string_view str)
+  -> std::optional<std::remove_cv_t<E>>
+{
+  auto value = impl::enum_hash_search<std::remove_cv_t<E>, Hash, true>(str);
+  if (value != nullptr) {
+    return static_cast<E>(*value);
   }
   return std::nullopt;
 }
@@ -0,0 +1,66 @@
+#ifndef REFLECT_CPP26_ENUM_ENUM_CAST_BATCH_HPP
+#define REFLECT_CPP26_ENUM_ENUM_CAST_BATCH_HPP
+
+#include <reflect_cpp26/enum/impl/enum_hash_batch_search.hpp>
+#include <reflect_cpp26/utils/concepts.hpp>
+#include <optional>
+#include <span>
+
+namespace reflect_cpp26 {
+/**
+ * Batched version of enum_cast(str):
+ * outputs[i] = enum_cast<E>(inputs[i]) for each 0 <= i < inputs.size().
+ * Returns the number of inputs that are successfully converted.
+ * Precondition: outputs.size() >= inputs.size().
+ */
+template <enum_type E,
+          string_hash_policy Hash = impl::enum_constants::hash_policy>
+constexpr auto enum_cast_batch(
+  std::span<const std::string_view> inputs,
+  std::span<std::optional<std::remove_cv_t<E>>> outputs) -> size_t
+{
+  auto success_count = 0zU;
+  impl::enum_hash_batch_search<std::remove_cv_t<E>, Hash>(inputs,
+    [&outputs, &success_count](size_t i, const uint64_t* value) {
+      if (value != nullptr) {
+        outputs[i] = static_cast<E>(*value);
+        success_count += 1;
+      } else {
+        outputs[i] = std::nullopt;
+      }
+    });
+  return success_count;
+}
+
+/**
+ * Batched version of enum_cast(str) with error bitmap:
+ * if enum_cast<E>(inputs[i]) succeeds, then outputs[i] is set to its value,
+ * and the i-th bit of error_bitmap (i.e. bit (i % 64) of error_bitmap[i / 64])
+ * is cleared. Otherwise, outputs[i] is unchanged, and the i-th bit is set.
+ * Returns the number of inputs that fail to convert.
+ * Precondition: outputs.size() >= inputs.size()
+ *           and error_bitmap.size() >= ceil(inputs.size() / 64).
+ */
+template <enum_type E,
+          string_hash_policy Hash = impl::enum_constants::hash_policy>
+constexpr auto enum_cast_batch(
+  std::span<const std::string_view> inputs,
+  std::span<std::remove_cv_t<E>> outputs,
+  std::span<uint64_t> error_bitmap) -> size_t
+{
+  auto error_count = 0zU;
+  std::ranges::fill(error_bitmap.first((inputs.size() + 63) / 64), 0);
+  impl::enum_hash_batch_search<std::remove_cv_t<E>, Hash>(inputs,
+    [&outputs, &error_bitmap, &error_count](size_t i, const uint64_t* value) {
+      if (value != nullptr) {
+        outputs[i] = static_cast<E>(*value);
+      } else {
+        error_bitmap[i / 64] |= uint64_t{1} << (i % 64);
+        error_count += 1;
+      }
+    });
+  return error_count;
+}
+} // namespace reflect_cpp26
+
+#endif // REFLECT_CPP26_ENUM_ENUM_CAST_BATCH_HPP
@@ -31,10 +31,26 @@ constexpr auto enum_contains(I value) -> bool
 
 /**
  * Whether an entry of enum type E with given name exists.
+ * Hash policy is configurable with Hash (see utils/string_hash.hpp).
  */
-template <enum_type E>
+template <enum_type E,
+          string_hash_policy Hash = impl::enum_constants::hash_policy>
 constexpr auto enum_contains(std::string_view str) -> bool {
-  return impl::enum_hash_search<E>(str) != nullptr;
+  return impl::enum_hash_search<std::remove_cv_t<E>, Hash>(str) != nullptr;
+}
+
+/**
+ * Whether an entry of enum type E whose name equals to str with ASCII case
+ * ignored exists.
+ * Compile error if two names of E with different values are equal
+ * with case ignored.
+ */
+template <enum_type E,
+          string_icase_hash_policy Hash = impl::enum_constants::hash_policy>
+constexpr auto enum_contains_icase(std::string_view str) -> bool
+{
+  using ENoCV = std::remove_cv_t<E>;
+  return impl::enum_hash_search<ENoCV, Hash, true>(str) != nullptr;
 }
 } // namespace reflect_cpp26
 
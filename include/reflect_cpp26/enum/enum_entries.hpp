@@ -16,12 +16,14 @@ namespace impl {
 template <class E, enum_entry_order Order>
 consteval auto make_enum_entries() /* -> std::array<enum_entry_t<E>, N> */
 {
+  // No pack expansion (see make_enum_meta_entry_list)
+  auto meta_entries = make_enum_meta_entry_list<E, Order>();
   auto entries = std::array<enum_entry_t<E>, enum_count_v<E>>{};
-  enum_meta_for_each<E, Order>([&entries](auto index, auto ec) {
-    entries[index].first = [:ec:];
-    entries[index].second =
-      reflect_cpp26::define_static_string(identifier_of(ec.value));
-  });
+  for (auto i = 0zU, n = meta_entries.size(); i < n; i++) {
+    entries[i].first = extract<E>(meta_entries[i]);
+    entries[i].second =
+      reflect_cpp26::define_static_string(identifier_of(meta_entries[i]));
+  }
   return entries;
 }
 
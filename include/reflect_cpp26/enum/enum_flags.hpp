@@ -0,0 +1,152 @@
+#ifndef REFLECT_CPP26_ENUM_ENUM_FLAGS_HPP
+#define REFLECT_CPP26_ENUM_ENUM_FLAGS_HPP
+
+#include <reflect_cpp26/enum/impl/enum_hash_entry_search.hpp>
+#include <reflect_cpp26/enum/enum_names.hpp>
+#include <reflect_cpp26/utils/concepts.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <climits>
+#include <optional>
+
+namespace reflect_cpp26 {
+namespace impl {
+template <class E>
+using enum_flags_bits_t = std::make_unsigned_t<std::underlying_type_t<E>>;
+
+// bit_names[b] is the name of entry whose value is (1 << b), or empty if
+// such entry does not exist.
+template <class E>
+consteval auto make_enum_flag_bit_names()
+{
+  using U = enum_flags_bits_t<E>;
+  auto res = std::array<std::string_view, sizeof(U) * CHAR_BIT>{};
+  for (auto b = 0zU; b < res.size(); b++) {
+    res[b] = enum_name(static_cast<E>(U{1} << b));
+  }
+  return res;
+}
+
+template <class E>
+constexpr auto enum_flag_bit_names_v = make_enum_flag_bit_names<E>();
+
+// Bits that can be decomposed into flag names.
+template <class E>
+consteval auto make_enum_flags_mask() -> enum_flags_bits_t<E>
+{
+  using U = enum_flags_bits_t<E>;
+  auto res = U{0};
+  for (auto b = 0zU; b < enum_flag_bit_names_v<E>.size(); b++) {
+    if (!enum_flag_bit_names_v<E>[b].empty()) {
+      res |= U{1} << b;
+    }
+  }
+  return res;
+}
+
+template <class E>
+constexpr auto enum_flags_mask_v = make_enum_flags_mask<E>();
+
+// Length of the longest result of enum_flags_name<E>(value, buffer).
+template <class E>
+consteval auto make_enum_flags_name_max_size() -> size_t
+{
+  auto res = 0zU;
+  auto count = 0zU;
+  for (auto name: enum_flag_bit_names_v<E>) {
+    if (!name.empty()) {
+      res += name.size();
+      count += 1;
+    }
+  }
+  res += (count == 0) ? 0 : count - 1; // Delimiters
+  return std::max(res, enum_name(static_cast<E>(0)).size());
+}
+
+template <class E>
+constexpr auto enum_flags_name_max_size_v =
+  make_enum_flags_name_max_size<E>();
+} // namespace impl
+
+/**
+ * Maximum number of characters written by enum_flags_name<E>(value, buffer).
+ */
+template <enum_type E>
+constexpr auto enum_flags_name_max_size() -> size_t {
+  return impl::enum_flags_name_max_size_v<std::remove_cv_t<E>>;
+}
+
+/**
+ * Writes the flag names of value to buffer, joined by '|' in ascending order
+ * of bits, e.g. "read|exec" for read = 1, write = 2, exec = 4. Only entries
+ * with a single bit set are used as flags. If value is 0, the name of
+ * the entry with value 0 (or empty string if not found) is written.
+ * Returns the number of characters written (without null-terminator), or
+ * npos if some bit of value does not correspond to any flag.
+ * Precondition: buffer has at least enum_flags_name_max_size<E>() characters.
+ */
+template <enum_type E>
+constexpr auto enum_flags_name(E value, char* buffer) -> size_t
+{
+  using ENoCV = std::remove_cv_t<E>;
+  using U = impl::enum_flags_bits_t<ENoCV>;
+  constexpr const auto& bit_names = impl::enum_flag_bit_names_v<ENoCV>;
+
+  auto bits = static_cast<U>(std::to_underlying(value));
+  if (bits == 0) {
+    auto name = enum_name(value);
+    std::ranges::copy(name, buffer);
+    return name.size();
+  }
+  if ((bits & ~impl::enum_flags_mask_v<ENoCV>) != 0) {
+    return npos;
+  }
+  auto* cur = buffer;
+  for (; bits != 0; bits &= bits - 1) {
+    if (cur != buffer) {
+      *cur++ = '|';
+    }
+    cur = std::ranges::copy(bit_names[std::countr_zero(bits)], cur).out;
+  }
+  return cur - buffer;
+}
+
+/**
+ * Parses str as enum names joined by '|' and returns the bitwise-or of their
+ * values, e.g. "read|exec" for read = 1, exec = 4. Any entry of E (including
+ * those with multiple bits set) is accepted as a token. Returns std::nullopt
+ * if str is empty or any token is not an enum name of E. Characters are
+ * matched exactly, i.e. spaces around '|' are not allowed.
+ * Hash policy is configurable with Hash (see utils/string_hash.hpp).
+ */
+template <enum_type E,
+          string_hash_policy Hash = impl::enum_constants::hash_policy>
+constexpr auto enum_flags_cast(std::string_view str)
+  -> std::optional<std::remove_cv_t<E>>
+{
+  using ENoCV = std::remove_cv_t<E>;
+  using U = impl::enum_flags_bits_t<ENoCV>;
+  if (str.empty()) {
+    return std::nullopt;
+  }
+  auto res = U{0};
+  for (auto head = 0zU; ; ) {
+    auto tail = str.find('|', head);
+    auto token = str.substr(head, tail - head);
+    // Reuses the name hash table of enum_cast per token
+    const auto* value = impl::enum_hash_search<ENoCV, Hash>(token);
+    if (value == nullptr) {
+      return std::nullopt;
+    }
+    res |= static_cast<U>(*value);
+    if (tail == std::string_view::npos) {
+      break;
+    }
+    head = tail + 1;
+  }
+  return static_cast<ENoCV>(res);
+}
+} // namespace reflect_cpp26
+
+#endif // REFLECT_CPP26_ENUM_ENUM_FLAGS_HPP
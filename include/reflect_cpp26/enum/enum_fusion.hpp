@@ -0,0 +1,61 @@
+#ifndef REFLECT_CPP26_ENUM_ENUM_FUSION_HPP
+#define REFLECT_CPP26_ENUM_ENUM_FUSION_HPP
+
+#include <reflect_cpp26/enum/enum_count.hpp>
+#include <reflect_cpp26/enum/enum_index.hpp>
+#include <reflect_cpp26/utils/concepts.hpp>
+#include <array>
+#include <limits>
+
+namespace reflect_cpp26 {
+namespace impl {
+template <class... Es>
+consteval auto enum_fusion_extent() -> size_t
+{
+  auto res = 1zU;
+  auto counts = std::array{enum_unique_count_v<Es>...};
+  for (auto n: counts) {
+    if (n != 0 && res > std::numeric_limits<size_t>::max() / n) {
+      compile_error("Too many combinations of enum values.");
+    }
+    res *= n;
+  }
+  return res;
+}
+
+template <class... Es>
+constexpr auto enum_fusion_extent_v = enum_fusion_extent<Es...>();
+} // namespace impl
+
+/**
+ * Number of distinct keys of enum_fusion(values...) with value types Es...,
+ * i.e. product of enum_unique_count<Es>()...
+ */
+template <enum_type... Es>
+constexpr auto enum_fusion_extent() -> size_t {
+  return impl::enum_fusion_extent_v<std::remove_cv_t<Es>...>;
+}
+
+/**
+ * Fuses enum values into a dense integer key in range
+ * [0, enum_fusion_extent<Es...>()), in mixed radix of unique indices:
+ * enum_fusion(a, b) == enum_unique_index(a) * enum_unique_count<B>()
+ *                    + enum_unique_index(b).
+ * Returns npos if any value is not an entry of its enum type.
+ */
+template <enum_type... Es>
+  requires (sizeof...(Es) > 0)
+constexpr auto enum_fusion(Es... values) -> size_t
+{
+  auto res = 0zU;
+  auto valid = ([&res](auto value) {
+    using E = decltype(value);
+    auto index = enum_unique_index(value);
+    res = res * enum_unique_count_v<E> + index;
+    return index != npos;
+  }(values) && ...);
+  return valid ? res : npos;
+}
+} // namespace reflect_cpp26
+
+#endif // REFLECT_CPP26_ENUM_ENUM_FUSION_HPP
@@ -5,6 +5,32 @@
 #include <reflect_cpp26/utils/concepts.hpp>
 
 namespace reflect_cpp26 {
+namespace impl {
+// Whether unique values of E are exactly 0, 1, ..., n-1 (n > 0).
+// Checked on keys directly since runs are not always built (e.g. too few
+// entries, or with value search strategy other than automatic).
+template <class E>
+constexpr bool enum_values_are_indices_v = []() {
+  // Keys are unique and sorted with signedness considered
+  const auto& keys = enum_value_entry_table_v<E>.keys;
+  return !keys.empty() && keys.front() == 0
+    && keys.back() == keys.size() - 1;
+}();
+
+// Equivalent to enum_unique_index(value) with precondition that
+// value is an entry of E, which compiles to a no-op cast if values of E
+// are 0, 1, ..., n-1.
+template <class E>
+constexpr auto enum_unique_index_unchecked(E value) -> size_t
+{
+  if constexpr (enum_values_are_indices_v<E>) {
+    return static_cast<size_t>(std::to_underlying(value));
+  } else {
+    return enum_value_search_index(value);
+  }
+}
+} // namespace impl
+
 /**
  * Gets the index of given enum value in specified order.
  * Returns npos if the value is not found.
@@ -0,0 +1,226 @@
+#ifndef REFLECT_CPP26_ENUM_ENUM_LOOKUP_STATS_HPP
+#define REFLECT_CPP26_ENUM_ENUM_LOOKUP_STATS_HPP
+
+#include <reflect_cpp26/enum/impl/enum_char_dispatch.hpp>
+#include <reflect_cpp26/enum/impl/enum_hash_entry_search.hpp>
+#include <reflect_cpp26/enum/impl/enum_value_entry_search.hpp>
+#include <reflect_cpp26/enum/enum_names.hpp>
+#include <reflect_cpp26/enum/enum_type_name.hpp>
+#include <reflect_cpp26/utils/concepts.hpp>
+#include <reflect_cpp26/utils/to_string.hpp>
+#include <string>
+
+namespace reflect_cpp26 {
+/**
+ * Path taken by value -> entry lookup (enum_name, enum_contains, etc.).
+ *   runs_only: all values are covered by runs of consecutive values;
+ *   linear_search, binary_search: values outside runs (if any) are searched
+ *     among all keys.
+ */
+enum class enum_value_lookup_kind {
+  empty,
+  slot_table,
+  runs_only,
+  linear_search,
+  binary_search,
+};
+
+/**
+ * Path taken by name -> entry lookup (enum_cast from string, etc.).
+ *   collision_fallback: binary search that tolerates equal hash values.
+ */
+enum class enum_name_lookup_kind {
+  empty,
+  char_dispatch,
+  collision_fallback,
+  linear_search,
+  binary_search,
+  hash_table,
+  perfect_hash,
+};
+
+/**
+ * Lookup structures generated for an enum type. Bytes are sizes of static
+ * arrays the lookup touches, excluding enum names which are shared.
+ */
+struct enum_lookup_stats_t {
+  size_t entry_count;
+  size_t unique_count;
+
+  enum_value_lookup_kind value_lookup;
+  size_t value_run_count;
+  size_t value_run_coverage; // Number of entries covered by runs
+  size_t value_slot_count;   // Including holes. 0 if slot table is unused
+  size_t value_table_bytes;
+
+  enum_name_lookup_kind name_lookup;
+  bool has_hash_collision;
+  uint64_t hash_seed;
+  size_t hash_table_size; // 0 if neither hash table is used
+  double hash_load_factor; // entry_count / hash_table_size, or 0
+  size_t name_table_bytes;
+
+  constexpr bool operator==(const enum_lookup_stats_t&) const = default;
+};
+
+namespace impl {
+template <class T>
+constexpr auto array_bytes(meta_span<T> span) -> size_t {
+  return span.size() * sizeof(T);
+}
+
+template <class E>
+consteval void fill_enum_value_lookup_stats(enum_lookup_stats_t& res)
+{
+  using namespace enum_constants;
+  constexpr const auto& tb = enum_value_entry_table_v<E>;
+  constexpr auto strategy = enum_value_search_strategy_v<E>;
+
+  res.value_run_count = tb.runs.size();
+  res.value_run_coverage = tb.keys.size() - tb.residual_size;
+  res.value_slot_count = tb.slots.size();
+  res.value_table_bytes = array_bytes(tb.entries) + array_bytes(tb.keys)
+    + array_bytes(tb.eytzinger.keys) + array_bytes(tb.eytzinger.indices)
+    + array_bytes(tb.runs) + array_bytes(tb.slots);
+
+  if (tb.entries.empty()) {
+    res.value_lookup = enum_value_lookup_kind::empty;
+  } else if (strategy == enum_value_search_strategy::linear_search) {
+    res.value_lookup = enum_value_lookup_kind::linear_search;
+  } else if (strategy == enum_value_search_strategy::binary_search) {
+    res.value_lookup = enum_value_lookup_kind::binary_search;
+  } else if (!tb.slots.empty()) {
+    res.value_lookup = enum_value_lookup_kind::slot_table;
+  } else if (tb.residual_size == 0) {
+    res.value_lookup = enum_value_lookup_kind::runs_only;
+  } else if (tb.keys.size() >= enable_binary_search_threshold) {
+    res.value_lookup = enum_value_lookup_kind::binary_search;
+  } else {
+    res.value_lookup = enum_value_lookup_kind::linear_search;
+  }
+}
+
+// Mirrors the dispatch in enum_hash_search<E, Hash>(str).
+template <class E, class Hash>
+consteval void fill_enum_name_lookup_stats(enum_lookup_stats_t& res)
+{
+  using namespace enum_constants;
+  constexpr auto strategy = enum_name_search_strategy_v<E>;
+  const auto& dense_list = enum_hash_entry_dense_list_v<E, Hash>;
+  const auto& dense_hashes = enum_hash_entry_dense_hashes_v<E, Hash>;
+
+  res.has_hash_collision = enum_name_has_hash_collision_v<E, Hash>;
+  res.hash_seed = enum_hash_seed_v<E, Hash>;
+  auto dense_bytes = array_bytes(dense_list) + array_bytes(dense_hashes);
+  auto set_dense_search = [&res, dense_bytes, &dense_list]() {
+    res.name_table_bytes = dense_bytes;
+    if (strategy == enum_name_search_strategy::linear_search) {
+      res.name_lookup = enum_name_lookup_kind::linear_search;
+    } else if (strategy == enum_name_search_strategy::binary_search
+        || dense_list.size() >= enable_binary_search_threshold) {
+      res.name_lookup = enum_name_lookup_kind::binary_search;
+    } else {
+      res.name_lookup = enum_name_lookup_kind::linear_search;
+    }
+  };
+  auto set_hash_table = [&res](size_t table_size, size_t table_bytes) {
+    const auto& pool = enum_hash_entry_pool_v<E, Hash>;
+    res.hash_table_size = table_size;
+    res.hash_load_factor = static_cast<double>(res.entry_count) / table_size;
+    res.name_table_bytes = table_bytes
+      + pool.names.size() + array_bytes(pool.values);
+  };
+
+  if constexpr (enum_count_v<E> == 0) {
+    res.name_lookup = enum_name_lookup_kind::empty;
+  } else if constexpr (enum_hash_uses_char_dispatch_v<E, false>) {
+    res.name_lookup = enum_name_lookup_kind::char_dispatch;
+    for (const auto& group: enum_char_dispatch_groups_v<E>) {
+      res.name_table_bytes += sizeof(group)
+        + array_bytes(group.keys) + array_bytes(group.entries);
+    }
+  } else if constexpr (enum_name_has_hash_collision_v<E, Hash>) {
+    res.name_lookup = enum_name_lookup_kind::collision_fallback;
+    res.name_table_bytes = array_bytes(dense_list);
+  } else if constexpr (enum_hash_uses_perfect_hash_v<E>) {
+    constexpr auto table = enum_hash_perfect_table_v<E, Hash>;
+    if constexpr (table.entries.empty()) {
+      set_dense_search();
+    } else {
+      res.name_lookup = enum_name_lookup_kind::perfect_hash;
+      set_hash_table(table.entries.size(),
+        array_bytes(table.entries) + array_bytes(table.pilots));
+    }
+  } else if constexpr (enum_hash_uses_table_lookup_v<E>) {
+    constexpr auto table = enum_hash_entry_sparse_list_v<E, Hash>;
+    if constexpr (table.empty()) {
+      set_dense_search();
+    } else {
+      res.name_lookup = enum_name_lookup_kind::hash_table;
+      set_hash_table(table.size(), array_bytes(table));
+    }
+  } else {
+    set_dense_search();
+  }
+}
+
+template <class E, class Hash>
+consteval auto make_enum_lookup_stats() -> enum_lookup_stats_t
+{
+  auto res = enum_lookup_stats_t{};
+  res.entry_count = enum_count_v<E>;
+  res.unique_count = enum_unique_count_v<E>;
+  fill_enum_value_lookup_stats<E>(res);
+  fill_enum_name_lookup_stats<E, Hash>(res);
+  return res;
+}
+
+template <class E, class Hash>
+constexpr auto enum_lookup_stats_v = make_enum_lookup_stats<E, Hash>();
+} // namespace impl
+
+/**
+ * Gets the lookup structures generated for enum type E and which paths
+ * enum_value_search (by value) and enum_hash_search (by name, with
+ * hash policy Hash) take.
+ */
+template <enum_type E,
+          string_hash_policy Hash = impl::enum_constants::hash_policy>
+constexpr auto enum_lookup_stats() -> enum_lookup_stats_t {
+  return impl::enum_lookup_stats_v<std::remove_cv_t<E>, Hash>;
+}
+
+/**
+ * Dumps enum_lookup_stats<E>() of each type E in Es..., one line per type
+ * in the format "type_name: key=value key=value ...".
+ */
+template <enum_type... Es>
+auto enum_lookup_stats_dump() -> std::string
+{
+  auto res = std::string{};
+  auto append = [&res]<class E>(std::type_identity<E>) {
+    constexpr auto stats = enum_lookup_stats<E>();
+    res += enum_type_name<E>();
+    res += ": entry_count=" + to_string(stats.entry_count);
+    res += " unique_count=" + to_string(stats.unique_count);
+    res += " value_lookup=";
+    res += enum_name(stats.value_lookup);
+    res += " value_run_count=" + to_string(stats.value_run_count);
+    res += " value_run_coverage=" + to_string(stats.value_run_coverage);
+    res += " value_slot_count=" + to_string(stats.value_slot_count);
+    res += " value_table_bytes=" + to_string(stats.value_table_bytes);
+    res += " name_lookup=";
+    res += enum_name(stats.name_lookup);
+    res += " has_hash_collision=" + to_string(stats.has_hash_collision);
+    res += " hash_seed=" + to_string(stats.hash_seed);
+    res += " hash_table_size=" + to_string(stats.hash_table_size);
+    res += " hash_load_factor=" + to_string(stats.hash_load_factor);
+    res += " name_table_bytes=" + to_string(stats.name_table_bytes);
+    res += '\n';
+  };
+  (append(std::type_identity<std::remove_cv_t<Es>>{}), ...);
+  return res;
+}
+} // namespace reflect_cpp26
+
+#endif // REFLECT_CPP26_ENUM_ENUM_LOOKUP_STATS_HPP
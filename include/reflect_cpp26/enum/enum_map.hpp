@@ -0,0 +1,93 @@
+#ifndef REFLECT_CPP26_ENUM_ENUM_MAP_HPP
+#define REFLECT_CPP26_ENUM_ENUM_MAP_HPP
+
+#include <reflect_cpp26/enum/enum_contains.hpp>
+#include <reflect_cpp26/enum/enum_count.hpp>
+#include <reflect_cpp26/enum/enum_index.hpp>
+#include <reflect_cpp26/utils/concepts.hpp>
+#include <array>
+
+namespace reflect_cpp26 {
+/**
+ * Fixed-size map from each unique entry of enum type E to a value of type V,
+ * stored as an array indexed by enum_unique_index(key).
+ * Key translation is a no-op if values of E are 0, 1, ..., n-1, or lookup
+ * via the value table of E otherwise. No hashing or allocation involved.
+ * Aggregate type like std::array: values are in ascending order of keys.
+ */
+template <enum_type E, class V>
+struct enum_map {
+  using key_type = std::remove_cv_t<E>;
+  using mapped_type = V;
+
+  static constexpr auto extent = enum_unique_count<E>();
+  std::array<V, extent> values;
+
+  static constexpr auto size() -> size_t {
+    return extent;
+  }
+
+  // Whether key is an entry of E.
+  static constexpr auto contains(key_type key) -> bool {
+    return enum_contains(key);
+  }
+
+  // Key of values[index]. Precondition: index < size().
+  static constexpr auto key_at(size_t index) -> key_type
+  {
+    const auto& keys = impl::enum_value_entry_table_v<key_type>.keys;
+    return static_cast<key_type>(keys[index]);
+  }
+
+  // Precondition: contains(key)
+  constexpr auto operator[](key_type key) -> V& {
+    return values[impl::enum_unique_index_unchecked(key)];
+  }
+
+  // Precondition: contains(key)
+  constexpr auto operator[](key_type key) const -> const V& {
+    return values[impl::enum_unique_index_unchecked(key)];
+  }
+
+  // Returns nullptr if key is not an entry of E.
+  constexpr auto find(key_type key) -> V*
+  {
+    auto index = enum_unique_index(key);
+    return (index == npos) ? nullptr : &values[index];
+  }
+
+  // Returns nullptr if key is not an entry of E.
+  constexpr auto find(key_type key) const -> const V*
+  {
+    auto index = enum_unique_index(key);
+    return (index == npos) ? nullptr : &values[index];
+  }
+
+  // Invokes func(key, value) in ascending order of keys.
+  template <class Func>
+  constexpr void for_each(Func&& func)
+  {
+    for (auto i = 0zU; i < extent; i++) {
+      func(key_at(i), values[i]);
+    }
+  }
+
+  // Invokes func(key, value) in ascending order of keys.
+  template <class Func>
+  constexpr void for_each(Func&& func) const
+  {
+    for (auto i = 0zU; i < extent; i++) {
+      func(key_at(i), values[i]);
+    }
+  }
+
+  constexpr auto begin() { return values.begin(); }
+  constexpr auto begin() const { return values.begin(); }
+  constexpr auto end() { return values.end(); }
+  constexpr auto end() const { return values.end(); }
+
+  constexpr bool operator==(const enum_map&) const = default;
+};
+} // namespace reflect_cpp26
+
+#endif // REFLECT_CPP26_ENUM_ENUM_MAP_HPP
@@ -8,78 +8,46 @@
 #include <algorithm>
 #include <ranges>
 #include <utility>
+#include <vector>
 
 namespace reflect_cpp26 {
 namespace impl {
-template <class E>
-consteval auto make_enum_meta_entries_original_order()
-  /* -> constant<std::meta::info...> */
-{
-  return REFLECT_CPP26_EXPAND(enumerators_of(^^E));
-}
-
-template <class E>
-consteval auto make_enum_meta_entries_sorted_by_value_impl()
-  /* -> std::array<std::meta::info, N> */
+// Enumerators of E with given order. Built by plain loops over
+// enumerators_of(^^E) without pack expansion, which keeps compile time
+// linear in enum_count<E>() for large enum types.
+template <class E, enum_entry_order Order>
+consteval auto make_enum_meta_entry_list() -> std::vector<std::meta::info>
 {
-  constexpr auto orig_order = make_enum_meta_entries_original_order<E>();
-  constexpr auto N = orig_order.size();
-  if constexpr (N == 0) {
-    return std::array<std::meta::info, N>{};
+  auto orig_order = enumerators_of(^^E);
+  if constexpr (Order == enum_entry_order::original) {
+    return orig_order;
   } else {
-    using iv_pair_t = std::pair<size_t, std::underlying_type_t<E>>;
-    auto iv_pairs = std::array<iv_pair_t, N>{};
-    orig_order.for_each([&iv_pairs](auto i, auto e) {
-      auto value = std::to_underlying([:e:]);
-      iv_pairs[i] = {i, value};
-    });
-    std::ranges::sort(iv_pairs, {}, &iv_pair_t::second);
-    auto res = std::array<std::meta::info, N>{};
-    for (auto i = 0zU; i < N; i++) {
-      res[i] = orig_order.values[iv_pairs[i].first];
+    using key_t = std::conditional_t<Order == enum_entry_order::by_value,
+      std::underlying_type_t<E>, std::string_view>;
+    using iv_pair_t = std::pair<size_t, key_t>;
+    auto iv_pairs = std::vector<iv_pair_t>{};
+    for (auto i = 0zU, n = orig_order.size(); i < n; i++) {
+      if constexpr (Order == enum_entry_order::by_value) {
+        auto value = std::to_underlying(extract<E>(orig_order[i]));
+        iv_pairs.emplace_back(i, value);
+      } else {
+        iv_pairs.emplace_back(i, identifier_of(orig_order[i]));
+      }
     }
-    return res;
-  }
-}
-
-template <class E>
-consteval auto make_enum_meta_entries_sorted_by_value()
-  /* -> constant<std::meta::info...> */
-{
-  return REFLECT_CPP26_EXPAND(
-    make_enum_meta_entries_sorted_by_value_impl<E>());
-}
-
-template <class E>
-consteval auto make_enum_meta_entries_sorted_by_name_impl()
-  /* -> std::array<std::meta::info, N> */
-{
-  constexpr auto orig_order = make_enum_meta_entries_original_order<E>();
-  constexpr auto N = orig_order.size();
-  if constexpr (N == 0) {
-    return std::array<std::meta::info, N>{};
-  } else {
-    using iv_pair_t = std::pair<size_t, std::string_view>;
-    auto iv_pairs = std::array<iv_pair_t, N>{};
-    orig_order.for_each([&iv_pairs](auto i, auto e) {
-      auto value = identifier_of(e.value);
-      iv_pairs[i] = {i, value};
-    });
     std::ranges::sort(iv_pairs, {}, &iv_pair_t::second);
-    auto res = std::array<std::meta::info, N>{};
-    for (auto i = 0zU; i < N; i++) {
-      res[i] = orig_order.values[iv_pairs[i].first];
+    auto res = std::vector<std::meta::info>{};
+    for (auto [i, _]: iv_pairs) {
+      res.push_back(orig_order[i]);
     }
     return res;
   }
 }
 
-template <class E>
-consteval auto make_enum_meta_entries_sorted_by_name()
+template <class E, enum_entry_order Order>
+consteval auto make_enum_meta_entries()
   /* -> constant<std::meta::info...> */
 {
-  return REFLECT_CPP26_EXPAND(
-    make_enum_meta_entries_sorted_by_name_impl<E>());
+  return REFLECT_CPP26_EXPAND(make_enum_meta_entry_list<E, Order>());
 }
 
 template <class E, enum_entry_order Order>
@@ -87,15 +55,15 @@ constexpr auto enum_meta_entries_v = compile_error("Invalid enum entry order.");
 
 template <class E>
 constexpr auto enum_meta_entries_v<E, enum_entry_order::original> =
-  make_enum_meta_entries_original_order<E>();
+  make_enum_meta_entries<E, enum_entry_order::original>();
 
 template <class E>
 constexpr auto enum_meta_entries_v<E, enum_entry_order::by_value> =
-  make_enum_meta_entries_sorted_by_value<E>();
+  make_enum_meta_entries<E, enum_entry_order::by_value>();
 
 template <class E>
 constexpr auto enum_meta_entries_v<E, enum_entry_order::by_name> =
-  make_enum_meta_entries_sorted_by_name<E>();
+  make_enum_meta_entries<E, enum_entry_order::by_name>();
 } // namespace impl
 
 /**
@@ -0,0 +1,30 @@
+#ifndef REFLECT_CPP26_ENUM_ENUM_PARSE_PREFIX_HPP
+#define REFLECT_CPP26_ENUM_ENUM_PARSE_PREFIX_HPP
+
+#include <reflect_cpp26/enum/impl/enum_trie.hpp>
+#include <reflect_cpp26/utils/concepts.hpp>
+#include <optional>
+#include <utility>
+
+namespace reflect_cpp26 {
+/**
+ * Finds the longest enum name of E that is a prefix of input.
+ * Returns (value, length of the name) if found, or (std::nullopt, 0)
+ * otherwise. Characters after the matched name are not checked, e.g.
+ * for enum E {red, red_orange}, "red_orange;" is parsed as (red_orange, 10),
+ * and both "red_" and "reddish" are parsed as (red, 3).
+ */
+template <enum_type E>
+constexpr auto enum_parse_prefix(std::string_view input)
+  -> std::pair<std::optional<std::remove_cv_t<E>>, size_t>
+{
+  constexpr auto trie = impl::enum_trie_v<std::remove_cv_t<E>>;
+  auto [node, consumed] = impl::enum_trie_longest_prefix(trie, input);
+  if (node == nullptr) {
+    return {std::nullopt, 0};
+  }
+  return {static_cast<E>(node->value), consumed};
+}
+} // namespace reflect_cpp26
+
+#endif // REFLECT_CPP26_ENUM_ENUM_PARSE_PREFIX_HPP
@@ -0,0 +1,165 @@
+#ifndef REFLECT_CPP26_ENUM_ENUM_SET_HPP
+#define REFLECT_CPP26_ENUM_ENUM_SET_HPP
+
+#include <reflect_cpp26/enum/enum_count.hpp>
+#include <reflect_cpp26/enum/enum_index.hpp>
+#include <reflect_cpp26/utils/concepts.hpp>
+#include <array>
+#include <bit>
+#include <initializer_list>
+
+namespace reflect_cpp26 {
+/**
+ * Set of unique entries of enum type E, stored as a bitset where bit i
+ * represents the entry with enum_unique_index == i. Set operations work on
+ * 64-bit words. Key translation is the same as enum_map<E, V>.
+ */
+template <enum_type E>
+struct enum_set {
+  using key_type = std::remove_cv_t<E>;
+
+  static constexpr auto extent = enum_unique_count<E>();
+  static constexpr auto word_count = (extent + 63) / 64;
+  std::array<uint64_t, word_count> words = {};
+
+  constexpr enum_set() = default;
+
+  // Precondition: each key is an entry of E.
+  constexpr enum_set(std::initializer_list<key_type> keys)
+  {
+    for (auto key: keys) {
+      insert(key);
+    }
+  }
+
+  // Set of all unique entries of E.
+  static constexpr auto all() -> enum_set
+  {
+    auto res = enum_set{};
+    for (auto& w: res.words) {
+      w = ~uint64_t{0};
+    }
+    if constexpr (extent % 64 != 0) {
+      res.words.back() = (uint64_t{1} << (extent % 64)) - 1;
+    }
+    return res;
+  }
+
+  // Returns false if key is not an entry of E.
+  constexpr auto contains(key_type key) const -> bool
+  {
+    auto index = enum_unique_index(key);
+    return index != npos && (words[index / 64] >> (index % 64) & 1u) != 0;
+  }
+
+  // Precondition: key is an entry of E.
+  constexpr void insert(key_type key)
+  {
+    auto index = impl::enum_unique_index_unchecked(key);
+    words[index / 64] |= uint64_t{1} << (index % 64);
+  }
+
+  // Precondition: key is an entry of E.
+  constexpr void erase(key_type key)
+  {
+    auto index = impl::enum_unique_index_unchecked(key);
+    words[index / 64] &= ~(uint64_t{1} << (index % 64));
+  }
+
+  constexpr void clear() {
+    words = {};
+  }
+
+  // Number of keys in the set.
+  constexpr auto size() const -> size_t
+  {
+    auto res = 0zU;
+    for (auto w: words) {
+      res += std::popcount(w);
+    }
+    return res;
+  }
+
+  constexpr auto empty() const -> bool
+  {
+    for (auto w: words) {
+      if (w != 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Invokes func(key) in ascending order of keys.
+  template <class Func>
+  constexpr void for_each(Func&& func) const
+  {
+    const auto& keys = impl::enum_value_entry_table_v<key_type>.keys;
+    for (auto i = 0zU; i < word_count; i++) {
+      for (auto w = words[i]; w != 0; w &= w - 1) {
+        func(static_cast<key_type>(keys[i * 64 + std::countr_zero(w)]));
+      }
+    }
+  }
+
+  // Union
+  constexpr auto operator|=(const enum_set& rhs) -> enum_set&
+  {
+    for (auto i = 0zU; i < word_count; i++) {
+      words[i] |= rhs.words[i];
+    }
+    return *this;
+  }
+
+  // Intersection
+  constexpr auto operator&=(const enum_set& rhs) -> enum_set&
+  {
+    for (auto i = 0zU; i < word_count; i++) {
+      words[i] &= rhs.words[i];
+    }
+    return *this;
+  }
+
+  // Difference
+  constexpr auto operator-=(const enum_set& rhs) -> enum_set&
+  {
+    for (auto i = 0zU; i < word_count; i++) {
+      words[i] &= ~rhs.words[i];
+    }
+    return *this;
+  }
+
+  // Symmetric difference
+  constexpr auto operator^=(const enum_set& rhs) -> enum_set&
+  {
+    for (auto i = 0zU; i < word_count; i++) {
+      words[i] ^= rhs.words[i];
+    }
+    return *this;
+  }
+
+  friend constexpr auto operator|(enum_set lhs, const enum_set& rhs)
+    -> enum_set {
+    return lhs |= rhs;
+  }
+
+  friend constexpr auto operator&(enum_set lhs, const enum_set& rhs)
+    -> enum_set {
+    return lhs &= rhs;
+  }
+
+  friend constexpr auto operator-(enum_set lhs, const enum_set& rhs)
+    -> enum_set {
+    return lhs -= rhs;
+  }
+
+  friend constexpr auto operator^(enum_set lhs, const enum_set& rhs)
+    -> enum_set {
+    return lhs ^= rhs;
+  }
+
+  constexpr bool operator==(const enum_set&) const = default;
+};
+} // namespace reflect_cpp26
+
+#endif // REFLECT_CPP26_ENUM_ENUM_SET_HPP
@@ -1,7 +1,13 @@
 #ifndef REFLECT_CPP26_ENUM_ENUM_SWITCH_HPP
 #define REFLECT_CPP26_ENUM_ENUM_SWITCH_HPP
 
+#include <reflect_cpp26/enum/impl/constants.hpp>
+#include <reflect_cpp26/enum/impl/enum_value_entry_search.hpp>
+#include <reflect_cpp26/enum/enum_count.hpp>
 #include <reflect_cpp26/enum/enum_for_each.hpp>
+#include <reflect_cpp26/enum/enum_fusion.hpp>
+#include <array>
+#include <utility>
 
 namespace reflect_cpp26 {
 namespace impl {
@@ -39,45 +45,185 @@ template <class E, class Func>
 using enum_switch_invoke_result_t =
   typename enum_switch_invoke_result_wrapped_t<E, Func>::type;
 
+// The I-th unique value of E in value order.
+template <class E, size_t I>
+constexpr auto enum_switch_case_v =
+  static_cast<E>(enum_value_entry_table_v<E>.keys[I]);
+
+template <class R, class E, size_t I, class Func>
+constexpr auto enum_switch_thunk(Func& func) -> R
+{
+  if constexpr (std::is_void_v<R>) {
+    func(constant<enum_switch_case_v<E, I>>{});
+  } else {
+    return func(constant<enum_switch_case_v<E, I>>{});
+  }
+}
+
+template <class R, class E, class Func, size_t... Is>
+consteval auto make_enum_switch_thunks(std::index_sequence<Is...>)
+{
+  using thunk_type = R (*)(Func&);
+  return std::array<thunk_type, sizeof...(Is)>{
+    &enum_switch_thunk<R, E, Is, Func>...};
+}
+
+// Jump table: thunks[i](func) invokes func with the i-th unique value of E.
+template <class R, class E, class Func>
+constexpr auto enum_switch_thunks_v = make_enum_switch_thunks<R, E, Func>(
+  std::make_index_sequence<enum_unique_count_v<E>>{});
+
+#define REFLECT_CPP26_ENUM_SWITCH_CASE(i)                         \
+  case (i):                                                       \
+    if constexpr (Page + (i) < enum_unique_count_v<E>) {          \
+      return enum_switch_thunk<R, E, Page + (i)>(func);           \
+    }                                                             \
+    break;
+#define REFLECT_CPP26_ENUM_SWITCH_CASE_4(i)   \
+  REFLECT_CPP26_ENUM_SWITCH_CASE(i)           \
+  REFLECT_CPP26_ENUM_SWITCH_CASE((i) + 1)     \
+  REFLECT_CPP26_ENUM_SWITCH_CASE((i) + 2)     \
+  REFLECT_CPP26_ENUM_SWITCH_CASE((i) + 3)
+#define REFLECT_CPP26_ENUM_SWITCH_CASE_16(i)  \
+  REFLECT_CPP26_ENUM_SWITCH_CASE_4(i)         \
+  REFLECT_CPP26_ENUM_SWITCH_CASE_4((i) + 4)   \
+  REFLECT_CPP26_ENUM_SWITCH_CASE_4((i) + 8)   \
+  REFLECT_CPP26_ENUM_SWITCH_CASE_4((i) + 12)
+#define REFLECT_CPP26_ENUM_SWITCH_CASE_64(i)  \
+  REFLECT_CPP26_ENUM_SWITCH_CASE_16(i)        \
+  REFLECT_CPP26_ENUM_SWITCH_CASE_16((i) + 16) \
+  REFLECT_CPP26_ENUM_SWITCH_CASE_16((i) + 32) \
+  REFLECT_CPP26_ENUM_SWITCH_CASE_16((i) + 48)
+
+// Real switch-case on index, 64 cases per page, so that func can be inlined.
+// Precondition: index < enum_unique_count_v<E>.
+template <class R, class E, size_t Page, class Func>
+constexpr auto enum_switch_by_cases(Func& func, size_t index) -> R
+{
+  switch (index - Page) {
+    REFLECT_CPP26_ENUM_SWITCH_CASE_64(0)
+    default:
+      break;
+  }
+  if constexpr (Page + 64 < enum_unique_count_v<E>) {
+    return enum_switch_by_cases<R, E, Page + 64>(func, index);
+  } else {
+    REFLECT_CPP26_UNREACHABLE("Index out of range.");
+  }
+}
+
+#undef REFLECT_CPP26_ENUM_SWITCH_CASE_64
+#undef REFLECT_CPP26_ENUM_SWITCH_CASE_16
+#undef REFLECT_CPP26_ENUM_SWITCH_CASE_4
+#undef REFLECT_CPP26_ENUM_SWITCH_CASE
+
+// Precondition: index < enum_unique_count_v<E>.
+template <class R, class E, class Func>
+constexpr auto enum_switch_invoke(Func& func, size_t index) -> R
+{
+  using namespace enum_constants;
+  if constexpr (enum_unique_count_v<E> < disable_switch_cases_threshold) {
+    return enum_switch_by_cases<R, E, 0>(func, index);
+  } else {
+    return enum_switch_thunks_v<R, E, Func>[index](func);
+  }
+}
+
+// Whether unique values of E are min, min + 1, ..., max without any hole,
+// e.g. 0, 1, ..., n-1.
+template <class E>
+constexpr bool enum_switch_values_are_dense_v = []() {
+  const auto& keys = enum_value_entry_table_v<E>.keys;
+  return !keys.empty() && keys.back() - keys.front() == keys.size() - 1;
+}();
+
+// Returns the unique index of value, or npos if not found.
+// Dense values are translated by subtraction only (which is folded into the
+// switch statement), without any dependent table search before dispatch.
+template <class E>
+constexpr auto enum_switch_index(E value) -> size_t
+{
+  if constexpr (enum_switch_values_are_dense_v<E>) {
+    constexpr const auto& keys = enum_value_entry_table_v<E>.keys;
+    auto offset = static_cast<uint64_t>(to_int64_or_uint64(value))
+      - keys.front();
+    return (offset < keys.size()) ? static_cast<size_t>(offset) : npos;
+  } else {
+    return enum_value_search_index(value);
+  }
+}
+
 template <class E, class Func>
 constexpr auto enum_switch_void(Func&& func, E value) -> void
 {
-  enum_for_each<E>([&func, value](auto e) {
-    if (e == value) {
-      func(e);
-      return false; // false: Does not continue
-    }
-    return true; // true: Continues
-  });
+  auto index = enum_switch_index(value);
+  if (index != npos) {
+    enum_switch_invoke<void, E>(func, index);
+  }
 }
 
 template <class T, class E, class Func>
 constexpr auto enum_switch_optional(Func&& func, E value) -> std::optional<T>
 {
-  auto res = std::optional<T>{};
-  enum_for_each<E>([&func, value, &res](auto e) {
-    if (e == value) {
-      res = func(e);
-      return false; // false: Does not continue
-    }
-    return true; // true: Continues
-  });
-  return res;
+  auto index = enum_switch_index(value);
+  if (index == npos) {
+    return std::nullopt;
+  }
+  return enum_switch_invoke<T, E>(func, index);
 }
 
 template <class T, class E, class Func>
 constexpr auto enum_switch_value(Func&& func, E value, T init)
   /* -> ResultT */
 {
-  enum_for_each<E>([&func, value, &init](auto e) {
-    if (e == value) {
-      init = func(e);
-      return false; // false: Does not continue
-    }
-    return true; // true: Continues
-  });
-  return init;
+  auto index = enum_switch_index(value);
+  if (index == npos) {
+    return init;
+  }
+  return enum_switch_invoke<T, E>(func, index);
+}
+
+// K = enum_fusion(e1, e2) where e1 and e2 are the values passed to func.
+template <class R, class E1, class E2, size_t K, class Func>
+constexpr auto enum_switch2_thunk(Func& func) -> R
+{
+  constexpr auto n2 = enum_unique_count_v<E2>;
+  using C1 = constant<enum_switch_case_v<E1, K / n2>>;
+  using C2 = constant<enum_switch_case_v<E2, K % n2>>;
+  if constexpr (std::is_void_v<R>) {
+    func(C1{}, C2{});
+  } else {
+    return func(C1{}, C2{});
+  }
 }
+
+template <class R, class E1, class E2, class Func, size_t... Ks>
+consteval auto make_enum_switch2_thunks(std::index_sequence<Ks...>)
+{
+  using thunk_type = R (*)(Func&);
+  return std::array<thunk_type, sizeof...(Ks)>{
+    &enum_switch2_thunk<R, E1, E2, Ks, Func>...};
+}
+
+// 2D jump table flattened in row-major order.
+template <class R, class E1, class E2, class Func>
+constexpr auto enum_switch2_thunks_v =
+  make_enum_switch2_thunks<R, E1, E2, Func>(
+    std::make_index_sequence<enum_fusion_extent_v<E1, E2>>{});
+
+template <class R, class E1, class E2, class Func, size_t... Ks>
+consteval auto enum_switch2_is_invocable_r(std::index_sequence<Ks...>) -> bool
+{
+  constexpr auto n2 = enum_unique_count_v<E2>;
+  return (std::is_invocable_r_v<R, Func,
+    constant<enum_switch_case_v<E1, Ks / n2>>,
+    constant<enum_switch_case_v<E2, Ks % n2>>> && ...);
+}
+
+template <class R, class E1, class E2, class Func>
+constexpr auto enum_switch2_is_invocable_r_v =
+  enum_switch2_is_invocable_r<R, E1, E2, Func>(
+    std::make_index_sequence<enum_fusion_extent_v<E1, E2>>{});
 } // namespace impl
 
 /**
@@ -139,6 +285,54 @@ constexpr auto enum_switch_to_common(Func&& func, E value, T&& default_value)
   return impl::enum_switch_value<ResultT>(
     std::forward<Func>(func), value, std::forward<T>(default_value));
 }
+
+/**
+ * Enum switch-case on a pair of values. Equivalent to nested enum_switch:
+ * case (E1::x, E2::y) for each x and y:
+ *   return func(constant<E1::x>{}, constant<E2::y>{}); // Or nothing if void
+ * default:
+ *   return std::nullopt; // Or no-op if T is void
+ * Dispatched by a 2D table indexed by enum_fusion(value1, value2).
+ */
+template <non_reference_type T = void, enum_type E1, enum_type E2, class Func>
+  requires (impl::enum_switch2_is_invocable_r_v<T, E1, E2, Func>)
+constexpr auto enum_switch2(Func&& func, E1 value1, E2 value2)
+{
+  auto key = enum_fusion(value1, value2);
+  const auto& thunks = impl::enum_switch2_thunks_v<
+    T, E1, E2, std::remove_reference_t<Func>>;
+  if constexpr (std::is_same_v<T, void>) {
+    if (key != npos) {
+      thunks[key](func);
+    }
+  } else {
+    if (key == npos) {
+      return std::optional<T>{};
+    }
+    return std::optional<T>{thunks[key](func)};
+  }
+}
+
+/**
+ * Enum switch-case on a pair of values with default value. Equivalent to:
+ * case (E1::x, E2::y) for each x and y:
+ *   return func(constant<E1::x>{}, constant<E2::y>{}) as decay(T);
+ * default:
+ *   return init;
+ */
+template <class T, enum_type E1, enum_type E2, class Func>
+  requires (impl::enum_switch2_is_invocable_r_v<std::decay_t<T>, E1, E2, Func>)
+constexpr auto enum_switch2(
+  Func&& func, E1 value1, E2 value2, T&& default_value) -> std::decay_t<T>
+{
+  auto key = enum_fusion(value1, value2);
+  if (key == npos) {
+    return std::forward<T>(default_value);
+  }
+  const auto& thunks = impl::enum_switch2_thunks_v<
+    std::decay_t<T>, E1, E2, std::remove_reference_t<Func>>;
+  return thunks[key](func);
+}
 } // namespace reflect_cpp26
 
 #endif // REFLECT_CPP26_ENUM_ENUM_SWITCH_HPP
@@ -0,0 +1,120 @@
+#ifndef REFLECT_CPP26_ENUM_ENUM_TO_CHARS_HPP
+#define REFLECT_CPP26_ENUM_ENUM_TO_CHARS_HPP
+
+#include <reflect_cpp26/enum/enum_names.hpp>
+#include <reflect_cpp26/enum/enum_type_name.hpp>
+#include <reflect_cpp26/utils/concepts.hpp>
+#include <reflect_cpp26/utils/to_string_utils.hpp>
+#include <algorithm>
+#include <charconv>
+#include <iterator>
+
+namespace reflect_cpp26 {
+namespace impl {
+// Integer type that the underlying value of E is formatted as.
+// Character types are formatted as integers as well.
+template <class E>
+using enum_to_chars_integer_t = std::conditional_t<
+  std::is_signed_v<std::underlying_type_t<E>>, int64_t, uint64_t>;
+
+template <class E>
+consteval auto make_enum_to_chars_max_size() -> size_t
+{
+  auto res = 0zU;
+  for (auto name: reflect_cpp26::enum_names<E>()) {
+    res = std::max(res, name.size());
+  }
+  // 2 : 2 punctuation characters ()
+  auto fallback_size = 2zU + enum_type_name<E>().size()
+    + max_decimal_digits(sizeof(E));
+  return std::max(res, fallback_size);
+}
+
+template <class E>
+constexpr auto enum_to_chars_max_size_v = make_enum_to_chars_max_size<E>();
+
+// Writes "(T)" followed by the underlying value regardless of whether
+// value is an entry of E.
+// Precondition: buffer has at least enum_to_chars_max_size_v<E> characters.
+template <class E>
+constexpr auto enum_to_chars_fallback_unchecked(char* buffer, E value)
+  -> char*
+{
+  *buffer++ = '(';
+  buffer = std::ranges::copy(enum_type_name<E>(), buffer).out;
+  *buffer++ = ')';
+  auto underlying = static_cast<enum_to_chars_integer_t<E>>(
+    std::to_underlying(value));
+  auto [ptr, ec] = std::to_chars(
+    buffer, buffer + max_decimal_digits(sizeof(E)), underlying);
+  if (std::errc{} != ec) {
+    REFLECT_CPP26_UNREACHABLE("Internal error");
+  }
+  return ptr;
+}
+
+// Precondition: buffer has at least enum_to_chars_max_size_v<E> characters.
+template <class E>
+constexpr auto enum_to_chars_unchecked(char* buffer, E value) -> char*
+{
+  auto name = enum_name(value);
+  if (!name.empty()) {
+    return std::ranges::copy(name, buffer).out;
+  }
+  return enum_to_chars_fallback_unchecked(buffer, value);
+}
+} // namespace impl
+
+/**
+ * Maximum number of characters written by enum_to_chars<E>(...).
+ */
+template <enum_type E>
+constexpr auto enum_to_chars_max_size() -> size_t {
+  return impl::enum_to_chars_max_size_v<std::remove_cv_t<E>>;
+}
+
+/**
+ * Writes the enum name of value to [first, last), or "(T)" followed by
+ * the underlying value in decimal if value is not an entry of T,
+ * where T is enum_type_name<E>(). Null-terminator is not written.
+ * Same convention as std::to_chars: returns {end of output, errc{}}
+ * on success, or {last, errc::value_too_large} if the output does not fit,
+ * in which case contents in [first, last) are unspecified.
+ */
+template <enum_type E>
+constexpr auto enum_to_chars(char* first, char* last, E value)
+  -> std::to_chars_result
+{
+  using ENoCV = std::remove_cv_t<E>;
+  auto size = static_cast<size_t>(last - first);
+  if (size >= impl::enum_to_chars_max_size_v<ENoCV>) {
+    // Fast path: no bounds check during writing.
+    return {impl::enum_to_chars_unchecked<ENoCV>(first, value), std::errc{}};
+  }
+  char buffer[impl::enum_to_chars_max_size_v<ENoCV>];
+  auto* tail = impl::enum_to_chars_unchecked<ENoCV>(buffer, value);
+  if (static_cast<size_t>(tail - buffer) > size) {
+    return {last, std::errc::value_too_large};
+  }
+  return {std::ranges::copy(buffer, tail, first).out, std::errc{}};
+}
+
+/**
+ * Writes the same characters as enum_to_chars(first, last, value) to out.
+ * Returns the output iterator past the last character written.
+ */
+template <enum_type E, std::output_iterator<char> OutputIt>
+constexpr auto enum_to_chars(OutputIt out, E value) -> OutputIt
+{
+  using ENoCV = std::remove_cv_t<E>;
+  auto name = enum_name(value);
+  if (!name.empty()) {
+    return std::ranges::copy(name, std::move(out)).out;
+  }
+  char buffer[impl::enum_to_chars_max_size_v<ENoCV>];
+  auto* tail = impl::enum_to_chars_fallback_unchecked<ENoCV>(buffer, value);
+  return std::ranges::copy(buffer, tail, std::move(out)).out;
+}
+} // namespace reflect_cpp26
+
+#endif // REFLECT_CPP26_ENUM_ENUM_TO_CHARS_HPP
@@ -11,6 +11,12 @@ namespace impl {
 template <class E, enum_entry_order Order>
 constexpr auto enum_values_v =
   enum_meta_entries<E, Order>().template map<extract_meta_value>();
+
+// Same as enum_values_v<E, Order>.values without pack expansion.
+template <class E, enum_entry_order Order>
+constexpr auto enum_value_list_v = reflect_cpp26::define_static_array(
+  make_enum_meta_entry_list<E, Order>()
+    | std::views::transform([](std::meta::info e) { return extract<E>(e); }));
 } // namespace impl
 
 /**
@@ -19,7 +25,7 @@ constexpr auto enum_values_v =
 template <class E, enum_entry_order Order = enum_entry_order::original>
 constexpr auto enum_values() -> std::span<const std::remove_cv_t<E>>
 {
-  return impl::enum_values_v<std::remove_cv_t<E>, Order>.values;
+  return impl::enum_value_list_v<std::remove_cv_t<E>, Order>;
 }
 
 /**
@@ -1,6 +1,7 @@
 #ifndef REFLECT_CPP26_ENUM_IMPL_CONSTANTS_HPP
 #define REFLECT_CPP26_ENUM_IMPL_CONSTANTS_HPP
 
+#include <reflect_cpp26/utils/string_hash.hpp>
 #include <cstddef>
 
 namespace reflect_cpp26::impl::enum_constants {
@@ -13,6 +14,15 @@ constexpr bool   enable_value_table_lookup_threshold_is_custom = false;
 constexpr size_t enable_value_table_lookup_threshold = 4;
 #endif
 
+#ifdef REFLECT_CPP26_ENUM_VALUE_SLOT_TABLE_MAX_SPAN_RATIO
+constexpr bool   value_slot_table_max_span_ratio_is_custom = true;
+constexpr size_t value_slot_table_max_span_ratio =
+  REFLECT_CPP26_ENUM_VALUE_SLOT_TABLE_MAX_SPAN_RATIO;
+#else
+constexpr bool   value_slot_table_max_span_ratio_is_custom = false;
+constexpr size_t value_slot_table_max_span_ratio = 4; // (max-min+1) / count
+#endif
+
 #ifdef REFLECT_CPP26_ENUM_ENABLE_HASH_TABLE_LOOKUP_THRESHOLD
 constexpr bool   enable_hash_table_lookup_threshold_is_custom = true;
 constexpr size_t enable_hash_table_lookup_threshold =
@@ -31,6 +41,33 @@ constexpr bool   disable_hash_table_lookup_threshold_is_custom = false;
 constexpr size_t disable_hash_table_lookup_threshold = 64;
 #endif
 
+#ifdef REFLECT_CPP26_ENUM_ENABLE_PERFECT_HASH_LOOKUP_THRESHOLD
+constexpr bool   enable_perfect_hash_lookup_threshold_is_custom = true;
+constexpr size_t enable_perfect_hash_lookup_threshold =
+  REFLECT_CPP26_ENUM_ENABLE_PERFECT_HASH_LOOKUP_THRESHOLD;
+#else
+constexpr bool   enable_perfect_hash_lookup_threshold_is_custom = false;
+constexpr size_t enable_perfect_hash_lookup_threshold = 64;
+#endif
+
+#ifdef REFLECT_CPP26_ENUM_PERFECT_HASH_BUCKET_SIZE
+constexpr bool   perfect_hash_bucket_size_is_custom = true;
+constexpr size_t perfect_hash_bucket_size =
+  REFLECT_CPP26_ENUM_PERFECT_HASH_BUCKET_SIZE;
+#else
+constexpr bool   perfect_hash_bucket_size_is_custom = false;
+constexpr size_t perfect_hash_bucket_size = 4; // Average entries per bucket
+#endif
+
+#ifdef REFLECT_CPP26_ENUM_DISABLE_CHAR_DISPATCH_THRESHOLD
+constexpr bool   disable_char_dispatch_threshold_is_custom = true;
+constexpr size_t disable_char_dispatch_threshold =
+  REFLECT_CPP26_ENUM_DISABLE_CHAR_DISPATCH_THRESHOLD;
+#else
+constexpr bool   disable_char_dispatch_threshold_is_custom = false;
+constexpr size_t disable_char_dispatch_threshold = 16;
+#endif
+
 #ifdef REFLECT_CPP26_ENUM_ENABLE_BINARY_SEARCH_THRESHOLD
 constexpr bool   enable_binary_search_threshold_is_custom = true;
 constexpr size_t enable_binary_search_threshold =
@@ -40,6 +77,15 @@ constexpr bool   enable_binary_search_threshold_is_custom = false;
 constexpr size_t enable_binary_search_threshold = 12;
 #endif
 
+#ifdef REFLECT_CPP26_ENUM_DISABLE_SWITCH_CASES_THRESHOLD
+constexpr bool   disable_switch_cases_threshold_is_custom = true;
+constexpr size_t disable_switch_cases_threshold =
+  REFLECT_CPP26_ENUM_DISABLE_SWITCH_CASES_THRESHOLD;
+#else
+constexpr bool   disable_switch_cases_threshold_is_custom = false;
+constexpr size_t disable_switch_cases_threshold = 256; // Jump table otherwise
+#endif
+
 #ifdef REFLECT_CPP26_ENUM_HASH_INV_MIN_LOAD_FACTOR
 constexpr bool   inv_min_load_factor_is_custom = true;
 constexpr size_t inv_min_load_factor =
@@ -48,6 +94,32 @@ constexpr size_t inv_min_load_factor =
 constexpr bool   inv_min_load_factor_is_custom = false;
 constexpr size_t inv_min_load_factor = 4; // Load factor >= 0.25 by default
 #endif
+
+#ifdef REFLECT_CPP26_ENUM_HASH_BATCH_BLOCK_SIZE
+constexpr bool   hash_batch_block_size_is_custom = true;
+constexpr size_t hash_batch_block_size =
+  REFLECT_CPP26_ENUM_HASH_BATCH_BLOCK_SIZE;
+#else
+constexpr bool   hash_batch_block_size_is_custom = false;
+constexpr size_t hash_batch_block_size = 8; // Inputs hashed in interleave
+#endif
+
+#ifdef REFLECT_CPP26_ENUM_HASH_POLICY
+constexpr bool hash_policy_is_custom = true;
+using hash_policy = REFLECT_CPP26_ENUM_HASH_POLICY;
+#else
+constexpr bool hash_policy_is_custom = false;
+using hash_policy = bkdr_hash_policy;
+#endif
+
+#ifdef REFLECT_CPP26_ENUM_HASH_MAX_SEED_RETRIES
+constexpr bool   hash_max_seed_retries_is_custom = true;
+constexpr size_t hash_max_seed_retries =
+  REFLECT_CPP26_ENUM_HASH_MAX_SEED_RETRIES;
+#else
+constexpr bool   hash_max_seed_retries_is_custom = false;
+constexpr size_t hash_max_seed_retries = 64;
+#endif
 } // namespace reflect_cpp26::impl::enum_constants
 
 #endif // REFLECT_CPP26_ENUM_IMPL_CONSTANTS_HPP
@@ -0,0 +1,174 @@
+#ifndef REFLECT_CPP26_ENUM_IMPL_ENUM_CHAR_DISPATCH_HPP
+#define REFLECT_CPP26_ENUM_IMPL_ENUM_CHAR_DISPATCH_HPP
+
+#include <reflect_cpp26/enum/impl/enum_entry.hpp>
+#include <reflect_cpp26/utils/expand.hpp>
+#include <algorithm>
+#include <array>
+
+namespace reflect_cpp26::impl {
+// Each distinguishing character takes 8 bits of the 32-bit dispatch key.
+constexpr size_t enum_char_dispatch_max_positions = 4;
+
+/**
+ * All enum names of the same length, distinguished by characters at
+ * a few positions (gperf-style). Entries are sorted by key, and entries
+ * with the same key (which happens only if more than 4 positions are
+ * required) are checked one by one.
+ */
+struct enum_char_dispatch_group {
+  size_t length;
+  size_t position_count;
+  std::array<uint32_t, enum_char_dispatch_max_positions> positions;
+  meta_span<uint32_t> keys;
+  meta_span<enum_hash_entry> entries;
+
+  // Precondition: str.size() == length
+  constexpr auto key_of(const char* str) const -> uint32_t
+  {
+    auto key = uint32_t{0};
+    for (auto i = 0zU; i < position_count; i++) {
+      auto c = static_cast<uint8_t>(str[positions[i]]);
+      key |= static_cast<uint32_t>(c) << (i * 8);
+    }
+    return key;
+  }
+};
+
+consteval auto count_distinct_char_dispatch_keys(std::vector<uint32_t> keys)
+  -> size_t
+{
+  std::ranges::sort(keys);
+  auto [s, t] = std::ranges::unique(keys);
+  return s - keys.begin();
+}
+
+// Precondition: all names in entries are of the same length
+consteval auto make_enum_char_dispatch_group(
+  std::span<const enum_hash_entry> entries) -> enum_char_dispatch_group
+{
+  auto n = entries.size();
+  auto res = enum_char_dispatch_group{.length = entries[0].name.size()};
+  auto keys = std::vector<uint32_t>(n);
+  // Greedy: picks the position with most distinct keys after extension
+  // until all keys are distinct, or no more positions are available.
+  for (auto distinct_count = 1zU; distinct_count < n
+      && res.position_count < enum_char_dispatch_max_positions; ) {
+    auto best_pos = npos;
+    auto best_keys = std::vector<uint32_t>{};
+    for (auto p = 0zU; p < res.length; p++) {
+      auto cur_keys = keys;
+      auto shift = res.position_count * 8;
+      for (auto i = 0zU; i < n; i++) {
+        auto c = static_cast<uint8_t>(entries[i].name[p]);
+        cur_keys[i] |= static_cast<uint32_t>(c) << shift;
+      }
+      auto cur_count = count_distinct_char_dispatch_keys(cur_keys);
+      if (cur_count > distinct_count) {
+        distinct_count = cur_count;
+        best_pos = p;
+        best_keys = std::move(cur_keys);
+      }
+    }
+    if (best_pos == npos) {
+      break; // Unreachable since names of the same length are distinct
+    }
+    res.positions[res.position_count++] = static_cast<uint32_t>(best_pos);
+    keys = std::move(best_keys);
+  }
+  auto order = std::vector<size_t>(n);
+  for (auto i = 0zU; i < n; i++) {
+    order[i] = i;
+  }
+  std::ranges::stable_sort(order, {}, [&keys](size_t i) { return keys[i]; });
+  auto sorted_keys = std::vector<uint32_t>{};
+  auto sorted_entries = std::vector<enum_hash_entry>{};
+  for (auto i: order) {
+    sorted_keys.push_back(keys[i]);
+    sorted_entries.push_back(entries[i]);
+  }
+  res.keys = reflect_cpp26::define_static_array(sorted_keys);
+  res.entries = reflect_cpp26::define_static_array(sorted_entries);
+  return res;
+}
+
+template <class E>
+consteval auto make_enum_char_dispatch_groups()
+  -> std::vector<enum_char_dispatch_group>
+{
+  auto entry_list = std::vector<enum_hash_entry>{};
+  for (auto [e, str]: enum_entries<E>()) {
+    entry_list.push_back({
+      .name_hash = 0, // Unused
+      .value = enum_hash_entry::make_value(e),
+      .name = meta_string_view::from_std_string_view(str),
+    });
+  }
+  std::ranges::sort(entry_list, [](const auto& x, const auto& y) {
+    return x.name.size() < y.name.size()
+      || (x.name.size() == y.name.size() && x.name < y.name);
+  });
+  auto res = std::vector<enum_char_dispatch_group>{};
+  for (auto first = entry_list.begin(); first != entry_list.end(); ) {
+    auto last = std::ranges::find_if(first, entry_list.end(),
+      [len = first->name.size()](const auto& e) {
+        return e.name.size() != len;
+      });
+    res.push_back(make_enum_char_dispatch_group({first, last}));
+    first = last;
+  }
+  return res;
+}
+
+template <class E>
+constexpr auto enum_char_dispatch_groups_v =
+  reflect_cpp26::define_static_array(make_enum_char_dispatch_groups<E>());
+
+// Precondition: str.size() == group.length
+constexpr auto enum_char_dispatch_group_search(
+  const enum_char_dispatch_group& group, std::string_view str)
+  -> const enum_hash_entry*
+{
+  const auto& keys = group.keys;
+  auto key = group.key_of(str.data());
+  // Branchless lower bound: no misprediction however the input is
+  auto first = 0zU;
+  for (auto len = keys.size(); len > 1; ) {
+    auto half = len / 2;
+    first = (keys[first + half] < key) ? first + half : first;
+    len -= half;
+  }
+  first += (keys[first] < key);
+  for (; first < keys.size() && keys[first] == key; first++) {
+    if (group.entries[first].name == str) {
+      return &group.entries[first];
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * Lookup without hashing the whole input string: dispatches by string length
+ * first (unrolled into a branch sequence), then by the packed key of
+ * distinguishing characters, and finally a single string comparison.
+ */
+template <class E>
+  /* requires std::is_enum_v<E> */
+constexpr auto enum_char_dispatch_search(std::string_view str)
+  -> const enum_hash_entry*
+{
+  constexpr auto group_count = enum_char_dispatch_groups_v<E>.size();
+  const enum_hash_entry* res = nullptr;
+  REFLECT_CPP26_EXPAND_I(group_count).for_each([&res, str](auto I) {
+    constexpr auto& group = enum_char_dispatch_groups_v<E>[I];
+    if (str.size() != group.length) {
+      return true; // Continues
+    }
+    res = enum_char_dispatch_group_search(group, str);
+    return false; // Stops
+  });
+  return res;
+}
+} // namespace reflect_cpp26::impl
+
+#endif // REFLECT_CPP26_ENUM_IMPL_ENUM_CHAR_DISPATCH_HPP
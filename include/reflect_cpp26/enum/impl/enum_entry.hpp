@@ -1,7 +1,10 @@
 #ifndef REFLECT_CPP26_ENUM_IMPL_ENUM_ENTRY_HPP
 #define REFLECT_CPP26_ENUM_IMPL_ENUM_ENTRY_HPP
 
+#include <reflect_cpp26/enum/impl/constants.hpp>
+#include <reflect_cpp26/enum/impl/enum_search_options.hpp>
 #include <reflect_cpp26/enum/enum_entries.hpp>
+#include <reflect_cpp26/utils/ctype.hpp>
 #include <reflect_cpp26/utils/define_static_values.hpp>
 #include <reflect_cpp26/utils/string_hash.hpp>
 #include <reflect_cpp26/utils/utility.hpp>
@@ -60,16 +63,18 @@ struct enum_entry_interface {
   }
 };
 
-struct alignas(32) enum_value_entry : enum_entry_interface<enum_value_entry> {
+// Not over-aligned: searching touches contiguous keys only (see
+// enum_value_entry_table below), and an entry is read once after a hit.
+struct enum_value_entry : enum_entry_interface<enum_value_entry> {
   uint64_t value; // value as primary key
   meta_string_view name;
-  uint16_t index_original_order;
-  uint16_t index_sorted_by_value;
-  uint16_t index_sorted_by_value_unique;
-  uint16_t index_sorted_by_name;
+  uint32_t index_original_order;
+  uint32_t index_sorted_by_value;
+  uint32_t index_sorted_by_value_unique;
+  uint32_t index_sorted_by_name;
 
   template <enum_entry_order Order>
-  constexpr auto index_sorted_by() const -> uint16_t
+  constexpr auto index_sorted_by() const -> uint32_t
   {
     if constexpr (Order == enum_entry_order::original) {
       return index_original_order;
@@ -86,7 +91,8 @@ struct alignas(32) enum_value_entry : enum_entry_interface<enum_value_entry> {
 constexpr size_t enum_hash_entry_alignment = std::bit_ceil(
   sizeof(uint64_t) + sizeof(uint64_t) + sizeof(meta_string_view));
 
-struct alignas(32) enum_hash_entry : enum_entry_interface<enum_hash_entry> {
+struct alignas(enum_hash_entry_alignment) enum_hash_entry
+  : enum_entry_interface<enum_hash_entry> {
   uint64_t name_hash; // name hash as primary key
   uint64_t value;
   meta_string_view name;
@@ -111,11 +117,11 @@ struct alignas(32) enum_hash_entry : enum_entry_interface<enum_hash_entry> {
 template <class E>
 consteval auto make_enum_value_entry_list() -> std::vector<enum_value_entry>
 {
-  static_assert(in_range<uint16_t>(enum_count_v<E>),
-    "Enum types with more than 65535 entries are not supported.");
+  static_assert(in_range<uint32_t>(enum_count_v<E>),
+    "Enum types with more than 2^32-1 entries are not supported.");
 
   auto entry_list = std::vector<enum_value_entry>{};
-  auto cur_index = uint16_t{0};
+  auto cur_index = uint32_t{0};
   for (auto [e, str]: enum_entries<E>()) {
     entry_list.push_back({
       .value = enum_value_entry::make_value(e),
@@ -125,7 +131,7 @@ consteval auto make_enum_value_entry_list() -> std::vector<enum_value_entry>
   }
   std::ranges::sort(entry_list, {}, &enum_value_entry::name);
   for (auto i = 0zU, n = entry_list.size(); i < n; i++) {
-    entry_list[i].index_sorted_by_name = static_cast<uint16_t>(i);
+    entry_list[i].index_sorted_by_name = static_cast<uint32_t>(i);
   }
   if constexpr (std::is_signed_v<std::underlying_type_t<E>>) {
     std::ranges::sort(entry_list, {}, &enum_value_entry::value_as_signed);
@@ -133,96 +139,360 @@ consteval auto make_enum_value_entry_list() -> std::vector<enum_value_entry>
     std::ranges::sort(entry_list, {}, &enum_value_entry::value);
   }
   for (auto i = 0zU, n = entry_list.size(); i < n; i++) {
-    entry_list[i].index_sorted_by_value = static_cast<uint16_t>(i);
+    entry_list[i].index_sorted_by_value = static_cast<uint32_t>(i);
   }
   auto [s, t] = std::ranges::unique(entry_list, {}, &enum_value_entry::value);
   entry_list.erase(s, t);
   for (auto i = 0zU, n = entry_list.size(); i < n; i++) {
-    entry_list[i].index_sorted_by_value_unique = static_cast<uint16_t>(i);
+    entry_list[i].index_sorted_by_value_unique = static_cast<uint32_t>(i);
   }
   return entry_list;
 }
 
+// Entries with ASCII-folded names (hash values are left as zero).
+// Names equal after case folding are merged if their values are the same,
+// or rejected otherwise.
 template <class E>
-consteval auto make_enum_hash_entry_list() -> std::vector<enum_hash_entry>
+consteval auto make_enum_icase_entry_list() -> std::vector<enum_hash_entry>
 {
   auto entry_list = std::vector<enum_hash_entry>{};
   for (auto [e, str]: enum_entries<E>()) {
-    auto name = meta_string_view::from_std_string_view(str);
+    auto folded = std::string{};
+    for (auto c: str) {
+      folded.push_back(tolower(c));
+    }
     entry_list.push_back({
-      .name_hash = bkdr_hash64(str),
       .value = enum_hash_entry::make_value(e),
-      .name = name,
+      .name = reflect_cpp26::define_static_string(folded),
+    });
+  }
+  std::ranges::sort(entry_list, [](const auto& x, const auto& y) {
+    return x.name < y.name || (x.name == y.name && x.value < y.value);
+  });
+  auto [s, t] = std::ranges::unique(entry_list,
+    [](const auto& x, const auto& y) {
+      return x.name == y.name && x.value == y.value;
     });
+  entry_list.erase(s, t);
+  for (auto i = 1zU, n = entry_list.size(); i < n; i++) {
+    if (entry_list[i].name == entry_list[i - 1].name) {
+      compile_error("Case-insensitive enum name collision detected.");
+    }
+  }
+  return entry_list;
+}
+
+template <class E>
+constexpr auto enum_icase_entry_list_v =
+  reflect_cpp26::define_static_array(make_enum_icase_entry_list<E>());
+
+// ICase: whether names are hashed and compared case-insensitively.
+template <class E, bool ICase>
+consteval auto enum_hashed_names() -> std::vector<std::string_view>
+{
+  auto res = std::vector<std::string_view>{};
+  if constexpr (ICase) {
+    for (const auto& e: enum_icase_entry_list_v<E>) {
+      res.push_back(e.name);
+    }
+  } else {
+    for (auto [_, str]: enum_entries<E>()) {
+      res.push_back(str);
+    }
+  }
+  return res;
+}
+
+template <class E, class Hash, bool ICase = false>
+consteval auto make_enum_hash_entry_list(uint64_t seed)
+  -> std::vector<enum_hash_entry>
+{
+  auto entry_list = std::vector<enum_hash_entry>{};
+  if constexpr (ICase) {
+    for (auto e: enum_icase_entry_list_v<E>) {
+      e.name_hash = Hash::operator()(e.name, seed); // Names are folded already
+      entry_list.push_back(e);
+    }
+  } else {
+    for (auto [e, str]: enum_entries<E>()) {
+      auto name = meta_string_view::from_std_string_view(str);
+      entry_list.push_back({
+        .name_hash = Hash::operator()(str, seed),
+        .value = enum_hash_entry::make_value(e),
+        .name = name,
+      });
+    }
   }
   std::ranges::sort(entry_list, &enum_hash_entry::less_by_hash_strong_order);
   return entry_list;
 }
 
-struct enum_value_entry_table {
-  meta_span<enum_value_entry> entries;
-  size_t continuous_head = 0;
-  size_t continuous_tail = 0;
+// Hash value of input string with the same policy as entries.
+template <class Hash, bool ICase>
+constexpr auto enum_name_hash(std::string_view str, uint64_t seed) -> uint64_t
+{
+  if constexpr (ICase) {
+    return Hash::hash_icase(str, seed);
+  } else {
+    return Hash::operator()(str, seed);
+  }
+}
 
-  static constexpr auto make(meta_span<enum_value_entry> entries)
-    -> enum_value_entry_table
-  {
-    auto res = enum_value_entry_table{};
-    res.entries = entries;
-    auto n = entries.size();
-    if (n <= 1) {
-      res.continuous_tail = n;
-      return res;
+// Precondition: name is ASCII-folded if ICase is true.
+template <bool ICase>
+constexpr auto enum_name_equals(std::string_view name, std::string_view str)
+  -> bool
+{
+  if constexpr (ICase) {
+    if (name.size() != str.size()) {
+      return false;
     }
-    size_t max_len_head = 0, max_len_tail = 0;
-    size_t cur_head = 0, cur_tail = 1;
-    while (cur_tail < n) {
-      while (cur_tail < n
-          && entries[cur_tail].value == entries[cur_tail - 1].value + 1) {
-        ++cur_tail;
+    for (auto i = 0zU, n = str.size(); i < n; i++) {
+      if (name[i] != tolower(str[i])) {
+        return false;
       }
-      if (cur_tail - cur_head > max_len_tail - max_len_head) {
-        max_len_head = cur_head;
-        max_len_tail = cur_tail;
-      }
-      cur_head = cur_tail;
-      cur_tail += 1;
     }
-    res.continuous_head = max_len_head;
-    res.continuous_tail = max_len_tail;
-    return res;
+    return true;
+  } else {
+    return name == str;
   }
+}
+
+/**
+ * Compact alternative to enum_hash_entry (16 bytes instead of 32) used by
+ * hash tables, which refers to its name and value in enum_hash_entry_pool.
+ * Empty slots of hash tables are all-zero.
+ */
+struct alignas(16) enum_packed_hash_entry {
+  uint64_t name_hash;
+  uint32_t name_offset;
+  uint16_t name_size;
+  uint16_t value_index;
+};
+
+/**
+ * Names and values referred by enum_packed_hash_entry:
+ * all names are concatenated into one contiguous static string.
+ */
+struct enum_hash_entry_pool {
+  meta_string_view names;
+  meta_span<uint64_t> values;
 
-  constexpr size_t sparse_left_size() const {
-    return continuous_head;
+  constexpr auto name_of(const enum_packed_hash_entry& e) const
+    -> std::string_view {
+    return {names.data() + e.name_offset, e.name_size};
   }
 
-  constexpr size_t continuous_size() const {
-    return continuous_tail - continuous_head;
+  constexpr auto value_of(const enum_packed_hash_entry& e) const
+    -> const uint64_t* {
+    return values.data() + e.value_index;
   }
+};
 
-  constexpr size_t sparse_right_size() const {
-    return entries.size() - continuous_tail;
+// Packed entries refer to pool made from the same entry list.
+consteval auto make_enum_packed_hash_entry_list(
+  std::span<const enum_hash_entry> entries)
+  -> std::vector<enum_packed_hash_entry>
+{
+  if (!in_range<uint16_t>(entries.size())) {
+    compile_error("Enum types with more than 65535 entries are not supported.");
+  }
+  auto res = std::vector<enum_packed_hash_entry>{};
+  auto offset = 0zU;
+  for (auto i = 0zU, n = entries.size(); i < n; i++) {
+    auto name_size = entries[i].name.size();
+    if (!in_range<uint16_t>(name_size) || !in_range<uint32_t>(offset)) {
+      compile_error("Enum names are too long.");
+    }
+    res.push_back({
+      .name_hash = entries[i].name_hash,
+      .name_offset = static_cast<uint32_t>(offset),
+      .name_size = static_cast<uint16_t>(name_size),
+      .value_index = static_cast<uint16_t>(i),
+    });
+    offset += name_size;
   }
+  return res;
+}
 
-  constexpr auto sparse_left_segment() const -> meta_span<enum_value_entry> {
-    return entries.first(continuous_head);
+consteval auto make_enum_hash_entry_pool(
+  std::span<const enum_hash_entry> entries) -> enum_hash_entry_pool
+{
+  auto names = std::string{};
+  auto values = std::vector<uint64_t>{};
+  for (const auto& e: entries) {
+    names.append(e.name.begin(), e.name.end());
+    values.push_back(e.value);
   }
+  return {
+    .names = reflect_cpp26::define_static_string(names),
+    .values = reflect_cpp26::define_static_array(values),
+  };
+}
 
-  constexpr auto continuous_segment() const -> meta_span<enum_value_entry> {
-    return entries.subspan(continuous_head, continuous_size());
+// Eytzinger (BFS) order of sorted keys: children of node k are 2k and 2k+1.
+// Node 0 is unused. indices[k] is the position of keys[k] in sorted order.
+struct enum_value_eytzinger_layout {
+  meta_span<uint64_t> keys;
+  meta_span<uint32_t> indices;
+};
+
+consteval void fill_enum_value_eytzinger_layout(
+  const std::vector<uint64_t>& sorted_keys, std::vector<uint64_t>& keys,
+  std::vector<uint32_t>& indices, size_t& cur, size_t k)
+{
+  if (k > sorted_keys.size()) {
+    return;
   }
+  fill_enum_value_eytzinger_layout(sorted_keys, keys, indices, cur, 2 * k);
+  keys[k] = sorted_keys[cur];
+  indices[k] = static_cast<uint32_t>(cur++);
+  fill_enum_value_eytzinger_layout(
+    sorted_keys, keys, indices, cur, 2 * k + 1);
+}
+
+consteval auto make_enum_value_eytzinger_layout(
+  const std::vector<uint64_t>& sorted_keys) -> enum_value_eytzinger_layout
+{
+  auto n = sorted_keys.size();
+  auto keys = std::vector<uint64_t>(n + 1);
+  auto indices = std::vector<uint32_t>(n + 1);
+  auto cur = 0zU;
+  fill_enum_value_eytzinger_layout(sorted_keys, keys, indices, cur, 1);
+  return {
+    .keys = reflect_cpp26::define_static_array(keys),
+    .indices = reflect_cpp26::define_static_array(indices),
+  };
+}
+
+constexpr auto enum_value_slot_hole = std::numeric_limits<uint16_t>::max();
 
-  constexpr auto sparse_right_segment() const -> meta_span<enum_value_entry> {
-    return entries.subspan(continuous_tail);
+// Run of consecutive values: keys[head + i] == min + i for 0 <= i < size.
+struct enum_value_run {
+  uint64_t min;
+  size_t head;
+  size_t size;
+
+  // Wrap-around of unsigned subtraction makes this correct for values
+  // below min regardless of signedness.
+  constexpr bool contains(uint64_t value) const {
+    return value - min < size;
   }
+};
+
+/**
+ * Entries sorted by value, with values duplicated into contiguous key arrays
+ * so that searching touches 8 bytes per entry only. Other members
+ * (name, index_*) in entries are touched only after a hit.
+ *
+ * Each maximal run of consecutive values with at least
+ * enable_value_table_lookup_threshold entries gets a direct-index window:
+ * one subtraction and one comparison replace searching among all entries.
+ * Shorter runs are not worth a window since each window adds
+ * a comparison to every lookup. Values outside all windows (residual) are
+ * searched among all keys.
+ *
+ * If values are bounded, i.e. (max - min + 1) is at most
+ * value_slot_table_max_span_ratio times the entry count, a slot table
+ * covering [min, max] is made instead, where slots[value - min] is the index
+ * of value in entries or enum_value_slot_hole if value is absent.
+ * It is skipped if all values are in a single run, which needs no table.
+ *
+ * Strategies other than automatic (see enum_value_search_strategy) build
+ * only the parts they need: keys only for linear search, Eytzinger layout
+ * for binary search, or slot table regardless of value span.
+ */
+struct enum_value_entry_table {
+  meta_span<enum_value_entry> entries;
+  meta_span<uint64_t> keys; // keys[i] == entries[i].value
+  enum_value_eytzinger_layout eytzinger;
+  meta_span<enum_value_run> runs; // Sorted by min
+  size_t residual_size = 0;
+  meta_span<uint16_t> slots; // Empty if slot table is not used
+  uint64_t slot_min = 0;
 
-  constexpr auto continuous_min() const -> const enum_value_entry& {
-    return entries[continuous_head];
+  // Limit of slot table size with enum_value_search_strategy::slot_table
+  static constexpr auto max_forced_slot_count = 1zU << 20;
+
+  static consteval auto make(
+    meta_span<enum_value_entry> entries,
+    enum_value_search_strategy strategy)
+    -> enum_value_entry_table
+  {
+    using namespace enum_constants;
+    auto res = enum_value_entry_table{};
+    res.entries = entries;
+    auto keys = std::vector<uint64_t>{};
+    for (const auto& e: entries) {
+      keys.push_back(e.value);
+    }
+    res.keys = reflect_cpp26::define_static_array(keys);
+    auto n = keys.size();
+    res.residual_size = n;
+    if (n == 0) {
+      return res;
+    }
+    switch (strategy) {
+      case enum_value_search_strategy::linear_search:
+        return res;
+      case enum_value_search_strategy::binary_search:
+        res.eytzinger = make_enum_value_eytzinger_layout(keys);
+        return res;
+      case enum_value_search_strategy::slot_table:
+        if (n >= enum_value_slot_hole) {
+          compile_error("Too many entries for slot table.");
+        }
+        if (keys.back() - keys.front() >= max_forced_slot_count) {
+          compile_error("Value range is too wide for slot table.");
+        }
+        res.make_slots(keys);
+        return res;
+      default:
+        break;
+    }
+    res.eytzinger = make_enum_value_eytzinger_layout(keys);
+
+    auto runs = std::vector<enum_value_run>{};
+    for (auto head = 0zU, tail = 0zU; head < n; head = tail) {
+      // Note: -1 is followed by 0 for signed enums as expected, and
+      // UINT64_MAX is never followed by 0 for unsigned enums.
+      tail = head + 1;
+      while (tail < n && keys[tail] == keys[tail - 1] + 1) {
+        ++tail;
+      }
+      if (tail - head >= std::max(enable_value_table_lookup_threshold, 1zU)) {
+        runs.push_back({.min = keys[head], .head = head, .size = tail - head});
+        res.residual_size -= tail - head;
+      }
+    }
+    res.runs = reflect_cpp26::define_static_array(runs);
+
+    if (runs.size() == 1 && res.residual_size == 0) {
+      return res;
+    }
+    // Note: keys.front() and keys.back() are min and max respectively with
+    // signedness considered. Unsigned subtraction never overflows.
+    auto span_minus_one = keys.back() - keys.front();
+    // Slots are 16-bit to keep the table dense in cache, thus large enum
+    // types with enum_value_slot_hole or more entries are not applicable.
+    if (n < enum_value_slot_hole
+        && span_minus_one < n * value_slot_table_max_span_ratio) {
+      res.make_slots(keys);
+    }
+    return res;
   }
 
-  constexpr auto continuous_max() const -> const enum_value_entry& {
-    return entries[continuous_tail - 1];
+  // Precondition: keys is non-empty and sorted with signedness considered.
+  consteval void make_slots(const std::vector<uint64_t>& keys)
+  {
+    auto span_minus_one = keys.back() - keys.front();
+    auto slots = std::vector<uint16_t>(span_minus_one + 1,
+                                       enum_value_slot_hole);
+    for (auto i = 0zU, n = keys.size(); i < n; i++) {
+      slots[keys[i] - keys.front()] = static_cast<uint16_t>(i);
+    }
+    this->slots = reflect_cpp26::define_static_array(slots);
+    this->slot_min = keys.front();
   }
 };
 
@@ -231,8 +501,8 @@ constexpr auto enum_value_entry_table_entries_v =
   reflect_cpp26::define_static_array(make_enum_value_entry_list<E>());
 
 template <class E>
-constexpr auto enum_value_entry_table_v =
-  enum_value_entry_table::make(enum_value_entry_table_entries_v<E>);
+constexpr auto enum_value_entry_table_v = enum_value_entry_table::make(
+  enum_value_entry_table_entries_v<E>, enum_value_search_strategy_v<E>);
 } // namespace reflect_cpp26::impl
 
 #endif // REFLECT_CPP26_ENUM_IMPL_ENUM_ENTRY_HPP
@@ -0,0 +1,101 @@
+#ifndef REFLECT_CPP26_ENUM_IMPL_ENUM_HASH_BATCH_SEARCH_HPP
+#define REFLECT_CPP26_ENUM_IMPL_ENUM_HASH_BATCH_SEARCH_HPP
+
+#include <reflect_cpp26/enum/impl/enum_hash_entry_search.hpp>
+#include <reflect_cpp26/utils/config.h>
+#include <algorithm>
+#include <array>
+
+namespace reflect_cpp26::impl {
+/**
+ * Processes inputs block by block. In each block:
+ *   (1) All inputs are hashed first. Hash computations of different inputs
+ *       are independent and can be overlapped by out-of-order execution;
+ *   (2) Table slots of all inputs are located and prefetched;
+ *   (3) Slots are compared with inputs, by which time the cache lines
+ *       are (hopefully) ready.
+ * locate(str_hash) -> const enum_packed_hash_entry*
+ * on_result(index, const uint64_t* value_or_null) -> void
+ */
+template <class Hash, class LocateFn, class ResultFn>
+constexpr void enum_hash_batch_probe(
+  std::span<const std::string_view> inputs, uint64_t seed,
+  const enum_hash_entry_pool& pool, const LocateFn& locate,
+  const ResultFn& on_result)
+{
+  constexpr auto block_size = enum_constants::hash_batch_block_size;
+  auto hashes = std::array<uint64_t, block_size>{};
+  auto slots = std::array<const enum_packed_hash_entry*, block_size>{};
+
+  for (auto head = 0zU, n = inputs.size(); head < n; head += block_size) {
+    auto m = std::min(block_size, n - head);
+    for (auto k = 0zU; k < m; k++) {
+      hashes[k] = Hash::operator()(inputs[head + k], seed);
+    }
+    for (auto k = 0zU; k < m; k++) {
+      slots[k] = locate(hashes[k]);
+      REFLECT_CPP26_PREFETCH(slots[k]);
+    }
+    for (auto k = 0zU; k < m; k++) {
+      const auto& str = inputs[head + k];
+      if (str.empty()) { // Empty slots may match empty string
+        on_result(head + k, nullptr);
+      } else {
+        on_result(head + k,
+          enum_packed_hash_entry_match(pool, slots[k], str, hashes[k]));
+      }
+    }
+  }
+}
+
+// Batched version of enum_hash_search<E, Hash>(str).
+template <class E, class Hash, class ResultFn>
+  /* requires (std::is_enum_v<E> && string_hash_policy<Hash>) */
+constexpr void enum_hash_batch_search(
+  std::span<const std::string_view> inputs, const ResultFn& on_result)
+{
+  constexpr auto enables_char_dispatch =
+    enum_hash_uses_char_dispatch_v<E, false>;
+  constexpr auto enables_table_lookup = enum_hash_uses_table_lookup_v<E>;
+  constexpr auto enables_perfect_hash_lookup =
+    enum_hash_uses_perfect_hash_v<E>;
+
+  auto search_one_by_one = [&inputs, &on_result]() {
+    for (auto i = 0zU, n = inputs.size(); i < n; i++) {
+      on_result(i, enum_hash_search<E, Hash>(inputs[i]));
+    }
+  };
+  // Seed and collision check are not instantiated for small enums
+  if constexpr (enum_count<E>() == 0 || enables_char_dispatch) {
+    search_one_by_one(); // No hashing required
+  } else if constexpr (enum_name_has_hash_collision_v<E, Hash>) {
+    search_one_by_one(); // Fallback on hash collision
+  } else if constexpr (enables_perfect_hash_lookup) {
+    if constexpr (enum_hash_perfect_table_v<E, Hash>.entries.empty()) {
+      search_one_by_one(); // Fallback on failure
+    } else {
+      auto locate = [](uint64_t str_hash) {
+        const auto& table = enum_hash_perfect_table_v<E, Hash>;
+        return table.entries.data() + table.slot_of(str_hash);
+      };
+      enum_hash_batch_probe<Hash>(inputs, enum_hash_seed_v<E, Hash>,
+        enum_hash_entry_pool_v<E, Hash>, locate, on_result);
+    }
+  } else if constexpr (enables_table_lookup) {
+    if constexpr (enum_hash_entry_sparse_list_v<E, Hash>.empty()) {
+      search_one_by_one(); // Fallback on failure
+    } else {
+      auto locate = [](uint64_t str_hash) {
+        const auto& table = enum_hash_entry_sparse_list_v<E, Hash>;
+        return table.data() + str_hash % table.size();
+      };
+      enum_hash_batch_probe<Hash>(inputs, enum_hash_seed_v<E, Hash>,
+        enum_hash_entry_pool_v<E, Hash>, locate, on_result);
+    }
+  } else {
+    search_one_by_one(); // Sorted list without a single slot to prefetch
+  }
+}
+} // namespace reflect_cpp26::impl
+
+#endif // REFLECT_CPP26_ENUM_IMPL_ENUM_HASH_BATCH_SEARCH_HPP
@@ -2,14 +2,19 @@
 #define REFLECT_CPP26_ENUM_IMPL_ENUM_HASH_ENTRY_SEARCH_HPP
 
 #include <reflect_cpp26/enum/impl/constants.hpp>
+#include <reflect_cpp26/enum/impl/enum_char_dispatch.hpp>
 #include <reflect_cpp26/enum/impl/enum_entry.hpp>
+#include <reflect_cpp26/enum/impl/enum_search_options.hpp>
 #include <reflect_cpp26/enum/impl/hash_collision_check.hpp>
 #include <reflect_cpp26/enum/enum_count.hpp>
+#include <reflect_cpp26/utils/simd_find.hpp>
+#include <numeric>
+#include <ranges>
 
 namespace reflect_cpp26::impl {
 // Precondition: no hash collision
 consteval auto is_valid_hash_modulo(
-  std::span<const enum_hash_entry> entries, size_t mod) -> bool
+  std::span<const enum_packed_hash_entry> entries, size_t mod) -> bool
 {
   auto vis = std::vector<bool>(mod);
   for (const auto& e: entries) {
@@ -22,11 +27,12 @@ consteval auto is_valid_hash_modulo(
   return true;
 }
 
-consteval size_t get_best_hash_modulo(std::span<const enum_hash_entry> entries)
+// inv_min_load_factor: upper bound of (modulo / entry count)
+consteval size_t get_best_hash_modulo(
+  std::span<const enum_packed_hash_entry> entries, double inv_min_load_factor)
 {
-  using namespace enum_constants;
   auto n = entries.size();
-  auto limit = n * inv_min_load_factor;
+  auto limit = static_cast<size_t>(n * inv_min_load_factor);
   for (auto cur = std::bit_ceil(n); cur <= limit; cur *= 2) {
     if (is_valid_hash_modulo(entries, cur)) {
       return cur;
@@ -40,73 +46,204 @@ consteval size_t get_best_hash_modulo(std::span<const enum_hash_entry> entries)
   return npos;
 }
 
-template <class E>
-  /* requires (std::is_enum_v<E>) */
-consteval auto make_enum_hash_entry_sparse_list()
-  -> std::vector<enum_hash_entry>
+// Precondition: no hash collision or zero hash value.
+consteval auto make_enum_hash_entry_sparse_list(
+  std::span<const enum_packed_hash_entry> entries, double inv_min_load_factor)
+  -> std::vector<enum_packed_hash_entry>
 {
-  // Precondition: no hash collision or zero hash value.
-  auto entries = make_enum_hash_entry_list<E>();
-  auto mod = get_best_hash_modulo(entries);
+  auto mod = get_best_hash_modulo(entries, inv_min_load_factor);
   if (mod == npos) {
     return {}; // Empty hash table on failure
   }
-  auto res = std::vector<enum_hash_entry>(mod);
+  auto res = std::vector<enum_packed_hash_entry>(mod);
   for (const auto& e: entries) {
     res[e.name_hash % mod] = e;
   }
   return res;
 }
 
+// Finalizer of MurmurHash3 that spreads all bits of x.
+constexpr auto enum_perfect_hash_mix(uint64_t x) -> uint64_t
+{
+  x ^= x >> 33;
+  x *= 0xff51'afd7'ed55'8ccdllu;
+  x ^= x >> 33;
+  x *= 0xc4ce'b9fe'1a85'ec53llu;
+  x ^= x >> 33;
+  return x;
+}
+
+// mixed_hash = enum_perfect_hash_mix(name_hash)
+constexpr auto enum_perfect_hash_slot(
+  uint64_t mixed_hash, uint64_t pilot, size_t table_size) -> size_t
+{
+  constexpr auto pilot_multiplier = 0x9e37'79b9'7f4a'7c15llu;
+  return enum_perfect_hash_mix(mixed_hash ^ (pilot * pilot_multiplier))
+    % table_size;
+}
+
+/**
+ * Minimal perfect hash table (PTHash-style): each entry is assigned to
+ * a bucket, and each bucket has a pilot value that displaces all its entries
+ * to distinct slots. Load factor is always 1.0.
+ */
+struct enum_hash_perfect_table {
+  meta_span<enum_packed_hash_entry> entries;
+  meta_span<uint16_t> pilots;
+
+  constexpr auto slot_of(uint64_t name_hash) const -> size_t
+  {
+    auto mixed = enum_perfect_hash_mix(name_hash);
+    auto pilot = pilots[mixed % pilots.size()];
+    return enum_perfect_hash_slot(mixed, pilot, entries.size());
+  }
+};
+
+// Precondition: no hash collision
+consteval auto make_enum_hash_perfect_table(
+  std::span<const enum_packed_hash_entry> entries) -> enum_hash_perfect_table
+{
+  using namespace enum_constants;
+  auto n = entries.size();
+  auto bucket_count = std::max(1zU,
+    (n + perfect_hash_bucket_size - 1) / perfect_hash_bucket_size);
+  auto buckets = std::vector<std::vector<size_t>>(bucket_count);
+  for (auto i = 0zU; i < n; i++) {
+    auto mixed = enum_perfect_hash_mix(entries[i].name_hash);
+    buckets[mixed % bucket_count].push_back(i);
+  }
+  // Larger buckets are placed first while the table is still sparse
+  auto bucket_order = std::vector<size_t>(bucket_count);
+  std::iota(bucket_order.begin(), bucket_order.end(), 0zU);
+  std::ranges::sort(bucket_order, [&buckets](size_t x, size_t y) {
+    auto x_size = buckets[x].size();
+    auto y_size = buckets[y].size();
+    return x_size > y_size || (x_size == y_size && x < y);
+  });
+
+  auto table = std::vector<enum_packed_hash_entry>(n);
+  auto occupied = std::vector<bool>(n);
+  auto pilots = std::vector<uint16_t>(bucket_count);
+  auto slots = std::vector<size_t>{};
+  for (auto b: bucket_order) {
+    if (buckets[b].empty()) {
+      break; // All remaining buckets are empty as well
+    }
+    auto found = false;
+    for (auto pilot = 0zU; !found && in_range<uint16_t>(pilot); pilot++) {
+      slots.clear();
+      found = true;
+      for (auto i: buckets[b]) {
+        auto mixed = enum_perfect_hash_mix(entries[i].name_hash);
+        auto slot = enum_perfect_hash_slot(mixed, pilot, n);
+        if (occupied[slot] || std::ranges::find(slots, slot) != slots.end()) {
+          found = false;
+          break;
+        }
+        slots.push_back(slot);
+      }
+      if (found) {
+        pilots[b] = static_cast<uint16_t>(pilot);
+      }
+    }
+    if (!found) {
+      return {}; // Empty hash table on failure
+    }
+    for (auto k = 0zU, m = slots.size(); k < m; k++) {
+      occupied[slots[k]] = true;
+      table[slots[k]] = entries[buckets[b][k]];
+    }
+  }
+  return {
+    .entries = reflect_cpp26::define_static_array(table),
+    .pilots = reflect_cpp26::define_static_array(pilots),
+  };
+}
+
 // Linear sorted list
-template <class E>
+template <class E, class Hash, bool ICase = false>
 constexpr auto enum_hash_entry_dense_list_v =
-  reflect_cpp26::define_static_array(make_enum_hash_entry_list<E>());
+  reflect_cpp26::define_static_array(
+    make_enum_hash_entry_list<E, Hash, ICase>(
+      enum_hash_seed_v<E, Hash, ICase>));
+
+// Hash values of the linear sorted list above in contiguous memory
+template <class E, class Hash, bool ICase = false>
+constexpr auto enum_hash_entry_dense_hashes_v =
+  reflect_cpp26::define_static_array(
+    enum_hash_entry_dense_list_v<E, Hash, ICase>
+      | std::views::transform(&enum_hash_entry::name_hash));
+
+// Names and values referred by packed entries below
+template <class E, class Hash, bool ICase = false>
+constexpr auto enum_hash_entry_pool_v =
+  make_enum_hash_entry_pool(enum_hash_entry_dense_list_v<E, Hash, ICase>);
+
+template <class E, class Hash, bool ICase = false>
+constexpr auto enum_packed_hash_entry_list_v =
+  reflect_cpp26::define_static_array(
+    make_enum_packed_hash_entry_list(
+      enum_hash_entry_dense_list_v<E, Hash, ICase>));
 
 // Hash table
-template <class E>
+template <class E, class Hash, bool ICase = false>
 constexpr auto enum_hash_entry_sparse_list_v =
-  reflect_cpp26::define_static_array(make_enum_hash_entry_sparse_list<E>());
+  reflect_cpp26::define_static_array(
+    make_enum_hash_entry_sparse_list(
+      enum_packed_hash_entry_list_v<E, Hash, ICase>,
+      enum_hash_inv_min_load_factor_v<E>));
+
+// Minimal perfect hash table
+template <class E, class Hash, bool ICase = false>
+constexpr auto enum_hash_perfect_table_v =
+  make_enum_hash_perfect_table(enum_packed_hash_entry_list_v<E, Hash, ICase>);
 
+// str_hash: hash value of str with the same hash policy and seed as entries
+// ICase: whether str is compared case-insensitively (entries are folded).
+template <bool ICase = false>
 constexpr auto enum_hash_binary_search_with_collision(
-  meta_span<enum_hash_entry> entries, std::string_view str)
+  meta_span<enum_hash_entry> entries, std::string_view str, uint64_t str_hash)
   -> const enum_hash_entry*
 {
-  auto str_hash = bkdr_hash64(str);
   auto [first, last] = std::ranges::equal_range(
     entries, str_hash, {}, &enum_hash_entry::name_hash);
   for (; first < last; ++first) {
-    if (str == first->name) {
+    if (enum_name_equals<ICase>(first->name, str)) {
       return first;
     }
   }
   return nullptr;
 }
 
+// hashes[i] == entries[i].name_hash. Hash values are scanned with SIMD.
+template <bool ICase = false>
 constexpr auto enum_hash_linear_search(
-  meta_span<enum_hash_entry> entries, std::string_view str)
-  -> const enum_hash_entry*
+  meta_span<enum_hash_entry> entries, meta_span<uint64_t> hashes,
+  std::string_view str, uint64_t str_hash) -> const enum_hash_entry*
 {
-  auto str_hash = bkdr_hash64(str);
-  auto [first, last] = entries;
-  for (; first < last; ++first) {
-    if (first->name_hash == str_hash && first->name == str) {
-      return first;
+  for (auto i = 0zU, n = hashes.size(); i < n; i++) {
+    auto offset = find_u64(hashes.subspan(i), str_hash);
+    if (offset == npos) {
+      break;
+    }
+    i += offset;
+    if (enum_name_equals<ICase>(entries[i].name, str)) {
+      return &entries[i];
     }
   }
   return nullptr;
 }
 
+template <bool ICase = false>
 constexpr auto enum_hash_binary_search(
-  meta_span<enum_hash_entry> entries, std::string_view str)
+  meta_span<enum_hash_entry> entries, std::string_view str, uint64_t str_hash)
   -> const enum_hash_entry*
 {
-  auto str_hash = bkdr_hash64(str);
   auto [first, last] = entries;
   while (first < last) {
     const auto* mid = first + (last - first) / 2;
     if (mid->name_hash == str_hash) {
-      return (mid->name == str) ? mid : nullptr;
+      return enum_name_equals<ICase>(mid->name, str) ? mid : nullptr;
     }
     if (mid->name_hash < str_hash) {
       first = mid + 1; // [mid+1, right)
@@ -117,49 +254,123 @@ constexpr auto enum_hash_binary_search(
   return nullptr;
 }
 
+template <bool ICase = false>
 constexpr auto enum_hash_search_dispatch(
-  meta_span<enum_hash_entry> entries, std::string_view str)
-  -> const enum_hash_entry*
+  meta_span<enum_hash_entry> entries, meta_span<uint64_t> hashes,
+  std::string_view str, uint64_t str_hash) -> const enum_hash_entry*
 {
   using namespace enum_constants;
   return entries.size() >= enable_binary_search_threshold
-    ? enum_hash_binary_search(entries, str)
-    : enum_hash_linear_search(entries, str);
+    ? enum_hash_binary_search<ICase>(entries, str, str_hash)
+    : enum_hash_linear_search<ICase>(entries, hashes, str, str_hash);
+}
+
+// Returns pointer to value of the packed entry if matched, or nullptr.
+// Precondition: str is non-empty (empty slots match empty string).
+template <bool ICase = false>
+constexpr auto enum_packed_hash_entry_match(
+  const enum_hash_entry_pool& pool, const enum_packed_hash_entry* pos,
+  std::string_view str, uint64_t str_hash) -> const uint64_t*
+{
+  if (pos->name_hash == str_hash
+      && enum_name_equals<ICase>(pool.name_of(*pos), str)) {
+    return pool.value_of(*pos);
+  }
+  return nullptr;
 }
 
 // Precondition: str is non-empty
+template <bool ICase = false>
 constexpr auto enum_hash_table_search(
-  meta_span<enum_hash_entry> entries, std::string_view str)
-  -> const enum_hash_entry*
+  meta_span<enum_packed_hash_entry> entries, const enum_hash_entry_pool& pool,
+  std::string_view str, uint64_t str_hash) -> const uint64_t*
 {
-  auto str_hash = bkdr_hash64(str);
   const auto* pos = entries.data() + str_hash % entries.size();
-  return (pos->name_hash == str_hash && pos->name == str) ? pos : nullptr;
+  return enum_packed_hash_entry_match<ICase>(pool, pos, str, str_hash);
 }
 
-template <class E>
-  /* requires (std::is_enum_v<E>) */
-constexpr auto enum_hash_search(std::string_view str) -> const enum_hash_entry*
+// Precondition: table is non-empty, str is non-empty
+template <bool ICase = false>
+constexpr auto enum_hash_perfect_table_search(
+  const enum_hash_perfect_table& table, const enum_hash_entry_pool& pool,
+  std::string_view str, uint64_t str_hash) -> const uint64_t*
 {
-  using namespace enum_constants;
-  constexpr auto enables_table_lookup =
-    enum_count<E>() >= enable_hash_table_lookup_threshold &&
-    enum_count<E>() < disable_hash_table_lookup_threshold;
+  const auto* pos = table.entries.data() + table.slot_of(str_hash);
+  return enum_packed_hash_entry_match<ICase>(pool, pos, str, str_hash);
+}
+
+constexpr auto enum_hash_entry_value(const enum_hash_entry* pos)
+  -> const uint64_t*
+{
+  return (pos == nullptr) ? nullptr : &pos->value;
+}
+
+/**
+ * Returns pointer to value of the entry whose name is str, or nullptr if
+ * not found.
+ * ICase: whether str is compared case-insensitively.
+ */
+template <class E, class Hash = enum_constants::hash_policy,
+          bool ICase = false>
+  /* requires (std::is_enum_v<E> && string_hash_policy<Hash>) */
+constexpr auto enum_hash_search(std::string_view str) -> const uint64_t*
+{
+  constexpr auto strategy = enum_name_search_strategy_v<E>;
+  constexpr auto enables_char_dispatch =
+    enum_hash_uses_char_dispatch_v<E, ICase>;
 
   if (str.empty() || enum_count<E>() == 0) {
     return nullptr;
   }
-  if constexpr (enum_name_has_hash_collision_v<E>) {
-    return enum_hash_binary_search_with_collision(
-      enum_hash_entry_dense_list_v<E>, str);
-  } else if constexpr (!enables_table_lookup) {
-    return enum_hash_search_dispatch(enum_hash_entry_dense_list_v<E>, str);
+  if constexpr (enables_char_dispatch) { // No hashing required
+    return enum_hash_entry_value(enum_char_dispatch_search<E>(str));
   } else {
-    constexpr auto hash_table = enum_hash_entry_sparse_list_v<E>;
-    if constexpr (hash_table.empty()) { // Fallback on failure
-      return enum_hash_search_dispatch(enum_hash_entry_dense_list_v<E>, str);
+    constexpr auto enables_table_lookup = enum_hash_uses_table_lookup_v<E>;
+    constexpr auto enables_perfect_hash_lookup =
+      enum_hash_uses_perfect_hash_v<E>;
+    constexpr auto dense_list = enum_hash_entry_dense_list_v<E, Hash, ICase>;
+    auto search_dense_list = [](std::string_view str, uint64_t str_hash) {
+      const auto& entries = enum_hash_entry_dense_list_v<E, Hash, ICase>;
+      const auto& hashes = enum_hash_entry_dense_hashes_v<E, Hash, ICase>;
+      if constexpr (strategy == enum_name_search_strategy::linear_search) {
+        return enum_hash_entry_value(
+          enum_hash_linear_search<ICase>(entries, hashes, str, str_hash));
+      } else if constexpr (
+          strategy == enum_name_search_strategy::binary_search) {
+        return enum_hash_entry_value(
+          enum_hash_binary_search<ICase>(entries, str, str_hash));
+      } else {
+        return enum_hash_entry_value(
+          enum_hash_search_dispatch<ICase>(entries, hashes, str, str_hash));
+      }
+    };
+
+    auto str_hash = enum_name_hash<Hash, ICase>(
+      str, enum_hash_seed_v<E, Hash, ICase>);
+    if constexpr (enum_name_has_hash_collision_v<E, Hash, ICase>) {
+      return enum_hash_entry_value(
+        enum_hash_binary_search_with_collision<ICase>(
+          dense_list, str, str_hash));
+    } else if constexpr (enables_perfect_hash_lookup) {
+      constexpr auto perfect_table =
+        enum_hash_perfect_table_v<E, Hash, ICase>;
+      if constexpr (perfect_table.entries.empty()) { // Fallback on failure
+        return search_dense_list(str, str_hash);
+      } else {
+        return enum_hash_perfect_table_search<ICase>(perfect_table,
+          enum_hash_entry_pool_v<E, Hash, ICase>, str, str_hash);
+      }
+    } else if constexpr (!enables_table_lookup) {
+      return search_dense_list(str, str_hash);
     } else {
-      return enum_hash_table_search(hash_table, str);
+      constexpr auto hash_table =
+        enum_hash_entry_sparse_list_v<E, Hash, ICase>;
+      if constexpr (hash_table.empty()) { // Fallback on failure
+        return search_dense_list(str, str_hash);
+      } else {
+        return enum_hash_table_search<ICase>(hash_table,
+          enum_hash_entry_pool_v<E, Hash, ICase>, str, str_hash);
+      }
     }
   }
 }
@@ -0,0 +1,101 @@
+#ifndef REFLECT_CPP26_ENUM_IMPL_ENUM_SEARCH_OPTIONS_HPP
+#define REFLECT_CPP26_ENUM_IMPL_ENUM_SEARCH_OPTIONS_HPP
+
+#include <reflect_cpp26/annotations/enum_properties.hpp>
+#include <reflect_cpp26/enum/impl/constants.hpp>
+#include <reflect_cpp26/enum/enum_count.hpp>
+#include <reflect_cpp26/utils/utility.hpp>
+
+// Per-enum search options annotated to enum declarations
+// (see annotations/enum_properties.hpp), or global defaults otherwise.
+namespace reflect_cpp26::impl {
+using annotations::enum_name_search_strategy;
+using annotations::enum_value_search_strategy;
+
+template <class E>
+constexpr auto enum_value_search_strategy_v =
+  annotations::enum_value_search_of<E>();
+
+template <class E>
+constexpr auto enum_name_search_strategy_v =
+  annotations::enum_name_search_of<E>();
+
+template <class E>
+consteval auto enum_hash_inv_min_load_factor() -> double
+{
+  constexpr auto load_factor = annotations::enum_hash_min_load_factor_of<E>();
+  if constexpr (!load_factor.has_value()) {
+    return static_cast<double>(enum_constants::inv_min_load_factor);
+  } else {
+    if (!(*load_factor > 0.0 && *load_factor <= 1.0)) {
+      compile_error("Load factor of hash table must be in range (0, 1].");
+    }
+    return 1.0 / *load_factor;
+  }
+}
+
+// Upper bound of (hash table size / entry count)
+template <class E>
+constexpr auto enum_hash_inv_min_load_factor_v =
+  enum_hash_inv_min_load_factor<E>();
+
+// Hash tables consist of packed entries with 16-bit value indices.
+// Larger enum types fall back to searching the linear sorted list.
+template <class E>
+constexpr auto enum_fits_packed_hash_entry_v =
+  in_range<uint16_t>(enum_count_v<E>);
+
+// Whether enum_hash_search looks up by first characters without hashing.
+template <class E, bool ICase>
+constexpr auto enum_hash_uses_char_dispatch_v =
+  !ICase && enum_name_search_strategy_v<E> ==
+    enum_name_search_strategy::automatic &&
+  enum_count_v<E> < enum_constants::disable_char_dispatch_threshold;
+
+// Whether enum_hash_search looks up in the minimal perfect hash table.
+template <class E>
+consteval auto enum_hash_uses_perfect_hash() -> bool
+{
+  using namespace enum_constants;
+  if (!enum_fits_packed_hash_entry_v<E>) {
+    return false;
+  }
+  switch (enum_name_search_strategy_v<E>) {
+    case enum_name_search_strategy::automatic:
+      return enum_count_v<E> >= enable_perfect_hash_lookup_threshold;
+    case enum_name_search_strategy::perfect_hash:
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <class E>
+constexpr auto enum_hash_uses_perfect_hash_v =
+  enum_hash_uses_perfect_hash<E>();
+
+// Whether enum_hash_search looks up in the open hash table.
+template <class E>
+consteval auto enum_hash_uses_table_lookup() -> bool
+{
+  using namespace enum_constants;
+  if (!enum_fits_packed_hash_entry_v<E>) {
+    return false;
+  }
+  switch (enum_name_search_strategy_v<E>) {
+    case enum_name_search_strategy::automatic:
+      return enum_count_v<E> >= enable_hash_table_lookup_threshold
+        && enum_count_v<E> < disable_hash_table_lookup_threshold;
+    case enum_name_search_strategy::hash_table:
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <class E>
+constexpr auto enum_hash_uses_table_lookup_v =
+  enum_hash_uses_table_lookup<E>();
+} // namespace reflect_cpp26::impl
+
+#endif // REFLECT_CPP26_ENUM_IMPL_ENUM_SEARCH_OPTIONS_HPP
@@ -0,0 +1,106 @@
+#ifndef REFLECT_CPP26_ENUM_IMPL_ENUM_TRIE_HPP
+#define REFLECT_CPP26_ENUM_IMPL_ENUM_TRIE_HPP
+
+#include <reflect_cpp26/enum/impl/enum_entry.hpp>
+#include <reflect_cpp26/enum/enum_entries.hpp>
+#include <reflect_cpp26/utils/define_static_values.hpp>
+
+namespace reflect_cpp26::impl {
+// Edges of each node are [edge_head, edge_tail) in enum_trie::labels
+// and enum_trie::targets.
+struct enum_trie_node {
+  uint64_t value;
+  uint32_t edge_head;
+  uint32_t edge_tail;
+  bool is_terminal;
+};
+
+/**
+ * Trie of all enum names. Node 0 is the root. Edge labels and targets are
+ * stored in separate arrays so that scanning labels of a node touches
+ * a contiguous byte range only.
+ */
+struct enum_trie {
+  meta_span<enum_trie_node> nodes;
+  meta_span<char> labels;
+  meta_span<uint32_t> targets;
+};
+
+template <class E>
+consteval auto make_enum_trie() -> enum_trie
+{
+  // Names sorted by name: names with common prefix are contiguous.
+  constexpr auto entries = enum_entries<E, enum_entry_order::by_name>();
+  static_assert(in_range<uint32_t>(entries.size()),
+    "Enum types with more than 2^32-1 entries are not supported.");
+
+  struct pending_node {
+    size_t first; // [first, last) in entries
+    size_t last;
+    size_t depth;
+  };
+  auto nodes = std::vector<enum_trie_node>(1);
+  auto labels = std::vector<char>{};
+  auto targets = std::vector<uint32_t>{};
+  auto queue = std::vector<pending_node>{{0, entries.size(), 0}};
+  // Breadth-first so that edges of each node are appended contiguously
+  for (auto q = 0zU; q < queue.size(); q++) {
+    auto [first, last, depth] = queue[q];
+    if (first < last && entries[first].second.size() == depth) {
+      nodes[q].is_terminal = true;
+      nodes[q].value = enum_hash_entry::make_value(entries[first].first);
+      first += 1;
+    }
+    nodes[q].edge_head = static_cast<uint32_t>(labels.size());
+    while (first < last) {
+      auto c = entries[first].second[depth];
+      auto child_last = first + 1;
+      while (child_last < last && entries[child_last].second[depth] == c) {
+        child_last += 1;
+      }
+      labels.push_back(c);
+      targets.push_back(static_cast<uint32_t>(queue.size()));
+      queue.push_back({first, child_last, depth + 1});
+      first = child_last;
+    }
+    nodes[q].edge_tail = static_cast<uint32_t>(labels.size());
+    nodes.resize(queue.size());
+  }
+  return {
+    .nodes = reflect_cpp26::define_static_array(nodes),
+    .labels = reflect_cpp26::define_static_array(labels),
+    .targets = reflect_cpp26::define_static_array(targets),
+  };
+}
+
+template <class E>
+constexpr auto enum_trie_v = make_enum_trie<E>();
+
+/**
+ * Walks the trie along input and returns the deepest terminal node reached
+ * with its depth, i.e. the enum name that is the longest prefix of input,
+ * or (nullptr, 0) if no enum name is a prefix of input.
+ */
+constexpr auto enum_trie_longest_prefix(
+  const enum_trie& trie, std::string_view input)
+  -> std::pair<const enum_trie_node*, size_t>
+{
+  auto res = std::pair<const enum_trie_node*, size_t>{nullptr, 0};
+  const auto* cur = trie.nodes.data();
+  for (auto i = 0zU, n = input.size(); i < n; i++) {
+    const auto* label_head = trie.labels.data() + cur->edge_head;
+    const auto* label_tail = trie.labels.data() + cur->edge_tail;
+    const auto* pos = std::ranges::find(label_head, label_tail, input[i]);
+    if (pos == label_tail) {
+      break;
+    }
+    cur = trie.nodes.data() + trie.targets[pos - trie.labels.data()];
+    if (cur->is_terminal) {
+      res = {cur, i + 1};
+    }
+  }
+  return res;
+}
+} // namespace reflect_cpp26::impl
+
+#endif // REFLECT_CPP26_ENUM_IMPL_ENUM_TRIE_HPP
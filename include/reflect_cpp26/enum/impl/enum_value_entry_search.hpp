@@ -4,98 +4,140 @@
 #include <reflect_cpp26/enum/impl/constants.hpp>
 #include <reflect_cpp26/enum/impl/enum_entry.hpp>
 #include <reflect_cpp26/enum/impl/hash_collision_check.hpp>
+#include <reflect_cpp26/utils/config.h>
+#include <reflect_cpp26/utils/simd_find.hpp>
+#include <algorithm>
+#include <bit>
 
 namespace reflect_cpp26::impl {
+// Returns the index of value in keys, or npos if not found.
 constexpr auto enum_value_linear_search(
-  meta_span<enum_value_entry> entries, uint64_t value)
-  -> const enum_value_entry*
+  meta_span<uint64_t> keys, uint64_t value) -> size_t
 {
-  auto [first, last] = entries;
-  for (; first != last; ++first) {
-    if (first->value == value) {
-      return first;
-    }
-  }
-  return nullptr;
+  return find_u64(keys, value);
 }
 
+/**
+ * Branchless lower-bound search in Eytzinger layout. The only data-dependent
+ * branch is the loop condition, whose trip count is fixed by the table size.
+ * Descendants 3 levels down (8 keys, i.e. one cache line) are prefetched.
+ * Returns the index of value in sorted order, or npos if not found.
+ */
 template <class T>
   /* requires (is_same_as_one_of_v<T, int64_t, uint64_t>) */
-constexpr auto enum_value_binary_search(
-  meta_span<enum_value_entry> entries, T value) -> const enum_value_entry*
+constexpr auto enum_value_eytzinger_search(
+  const enum_value_eytzinger_layout& layout, T value) -> size_t
 {
-  auto [first, last] = entries;
-  while (first < last) {
-    auto mid = first + (last - first) / 2;
-    if (mid->value == value) {
-      return mid;
-    }
-    if (mid->value_as_signedness_of(value) < value) {
-      first = mid + 1; // [mid+1, last)
-    } else {
-      last = mid; // [first, mid)
-    }
+  const auto* keys = layout.keys.data();
+  auto n = layout.keys.size() - 1;
+  auto k = 1zU;
+  while (k <= n) {
+    REFLECT_CPP26_PREFETCH(keys + std::min(8 * k, n));
+    k = 2 * k + (static_cast<T>(keys[k]) < value);
+  }
+  // Cancels the trailing right turns and the last left turn
+  k >>= std::countr_one(k) + 1;
+  if (k == 0 || static_cast<T>(keys[k]) != value) {
+    return npos;
   }
-  return nullptr;
+  return layout.indices[k];
 }
 
+// Returns the index of value among all keys of table, or npos if not found.
 template <class T>
   /* requires (is_same_as_one_of_v<T, int64_t, uint64_t>) */
 constexpr auto enum_value_search_dispatch(
-  meta_span<enum_value_entry> entries, T value) -> const enum_value_entry*
+  const enum_value_entry_table& table, T value) -> size_t
 {
   using namespace enum_constants;
-  if (entries.size() >= enable_binary_search_threshold) {
-    return enum_value_binary_search(entries, value);
+  if (table.keys.size() >= enable_binary_search_threshold) {
+    return enum_value_eytzinger_search(table.eytzinger, value);
   }
-  return enum_value_linear_search(entries, value);
+  return enum_value_linear_search(table.keys, value);
 }
 
-template <class E>
-  /* requires (std::is_enum_v<E>) */
-constexpr auto enum_value_search(E enum_value) -> const enum_value_entry*
+// Returns the run which contains value, or nullptr if not found.
+template <class T>
+  /* requires (is_same_as_one_of_v<T, int64_t, uint64_t>) */
+constexpr auto enum_value_run_search(
+  meta_span<enum_value_run> runs, T value) -> const enum_value_run*
 {
   using namespace enum_constants;
-  constexpr auto tb = enum_value_entry_table_v<E>;
-  if (tb.entries.empty()) {
+  if (runs.size() < enable_binary_search_threshold) {
+    for (const auto& run: runs) {
+      if (run.contains(value)) {
+        return &run;
+      }
+    }
     return nullptr;
   }
-  auto value = to_int64_or_uint64(enum_value);
-  if (tb.continuous_size() < enable_value_table_lookup_threshold) {
-    return enum_value_search_dispatch(tb.entries, value);
+  // The last run whose min <= value
+  auto pos = std::ranges::upper_bound(runs, value, {},
+    [](const enum_value_run& run) { return static_cast<T>(run.min); });
+  if (pos == runs.begin() || !pos[-1].contains(value)) {
+    return nullptr;
   }
-  if (value < tb.continuous_min().value_as_signedness_of(value)) {
-    return enum_value_search_dispatch(tb.sparse_left_segment(), value);
+  return &pos[-1];
+}
+
+// Returns the index of enum_value in enum_value_entry_table_v<E>.entries,
+// or npos if not found.
+template <class E>
+  /* requires (std::is_enum_v<E>) */
+constexpr auto enum_value_search_index(E enum_value) -> size_t
+{
+  constexpr const auto& tb = enum_value_entry_table_v<E>;
+  constexpr auto strategy = enum_value_search_strategy_v<E>;
+  if constexpr (tb.entries.empty()) {
+    return npos;
+  } else {
+    auto value = to_int64_or_uint64(enum_value);
+    // Only keys or Eytzinger layout is built with these strategies
+    if constexpr (strategy == enum_value_search_strategy::linear_search) {
+      return enum_value_linear_search(tb.keys, static_cast<uint64_t>(value));
+    } else if constexpr (
+        strategy == enum_value_search_strategy::binary_search) {
+      return enum_value_eytzinger_search(tb.eytzinger, value);
+    } else if constexpr (!tb.slots.empty()) {
+      auto offset = static_cast<uint64_t>(value) - tb.slot_min;
+      if (offset >= tb.slots.size()) {
+        return npos;
+      }
+      auto index = tb.slots[offset];
+      return (index == enum_value_slot_hole) ? npos : index;
+    } else {
+      if constexpr (!tb.runs.empty()) {
+        const auto* run = enum_value_run_search(tb.runs, value);
+        if (run != nullptr) {
+          return run->head + static_cast<size_t>(
+            static_cast<uint64_t>(value) - run->min);
+        }
+      }
+      if constexpr (tb.residual_size == 0) {
+        return npos; // All entries are covered by runs
+      } else {
+        return enum_value_search_dispatch(tb, value);
+      }
+    }
   }
-  if (value > tb.continuous_max().value_as_signedness_of(value)) {
-    return enum_value_search_dispatch(tb.sparse_right_segment(), value);
+}
+
+template <class E>
+  /* requires (std::is_enum_v<E>) */
+constexpr auto enum_value_search(E enum_value) -> const enum_value_entry*
+{
+  auto index = enum_value_search_index(enum_value);
+  if (index == npos) {
+    return nullptr;
   }
-  auto offset = value - tb.continuous_min().value_as_signedness_of(value);
-  return tb.entries.data() + tb.continuous_head + offset;
+  return enum_value_entry_table_v<E>.entries.data() + index;
 }
 
 template <class E>
   /* requires (std::is_enum_v<E>) */
 constexpr auto enum_value_contains(E enum_value) -> bool
 {
-  using namespace enum_constants;
-  constexpr auto tb = enum_value_entry_table_v<E>;
-  if (tb.entries.empty()) {
-    return false;
-  }
-  auto value = to_int64_or_uint64(enum_value);
-  if (tb.continuous_size() < enable_value_table_lookup_threshold) {
-    return enum_value_search_dispatch(tb.entries, value) != nullptr;
-  }
-  if (value < tb.continuous_min().value_as_signedness_of(value)) {
-    auto pos = enum_value_search_dispatch(tb.sparse_left_segment(), value);
-    return pos != nullptr;
-  }
-  if (value > tb.continuous_max().value_as_signedness_of(value)) {
-    auto pos = enum_value_search_dispatch(tb.sparse_right_segment(), value);
-    return pos != nullptr;
-  }
-  return true;
+  return enum_value_search_index(enum_value) != npos;
 }
 } // namespace reflect_cpp26::impl
 
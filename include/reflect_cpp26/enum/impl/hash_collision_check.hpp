@@ -1,32 +1,61 @@
 #ifndef REFLECT_CPP26_ENUM_IMPL_HASH_COLLISION_CHECK_HPP
 #define REFLECT_CPP26_ENUM_IMPL_HASH_COLLISION_CHECK_HPP
 
-#include <reflect_cpp26/enum/enum_for_each.hpp>
+#include <reflect_cpp26/enum/impl/constants.hpp>
+#include <reflect_cpp26/enum/impl/enum_entry.hpp>
+#include <reflect_cpp26/enum/impl/enum_search_options.hpp>
 #include <reflect_cpp26/utils/string_hash.hpp>
 #include <algorithm>
 
 namespace reflect_cpp26::impl {
-template <class E>
-consteval bool enum_name_has_hash_collision()
+// ICase: whether names are hashed case-insensitively.
+template <class E, class Hash, bool ICase = false>
+consteval bool enum_name_has_hash_collision(uint64_t seed)
 {
-  if constexpr (enum_count<E>() != 0) {
-    auto hash_values = enum_meta_entries<E>().map([](auto ec) {
-      return bkdr_hash64(identifier_of(ec.value));
-    });
-    std::ranges::sort(hash_values);
-    return hash_values[0] == 0
-      || std::ranges::adjacent_find(hash_values) != hash_values.end();
-  } else {
+  auto hash_values = std::vector<uint64_t>{};
+  for (auto str: enum_hashed_names<E, ICase>()) {
+    hash_values.push_back(Hash::operator()(str, seed));
+  }
+  if (hash_values.empty()) {
     return false;
   }
+  std::ranges::sort(hash_values);
+  return hash_values[0] == 0
+    || std::ranges::adjacent_find(hash_values) != hash_values.end();
+}
+
+// Uses the seed annotated to E if any. Otherwise, tries seeds 0, 1, 2...
+// until hash collision disappears.
+// Seed 0 is used if all the attempts fail or Hash is not seeded.
+template <class E, class Hash, bool ICase = false>
+consteval auto enum_hash_seed() -> uint64_t
+{
+  using namespace enum_constants;
+  constexpr auto annotated_seed = annotations::enum_hash_seed_of<E>();
+  if constexpr (Hash::is_seeded && annotated_seed.has_value()) {
+    return *annotated_seed;
+  } else if constexpr (Hash::is_seeded) {
+    for (auto seed = 0zU; seed < hash_max_seed_retries; seed++) {
+      if (!enum_name_has_hash_collision<E, Hash, ICase>(seed)) {
+        return seed;
+      }
+    }
+  }
+  return 0;
 }
 
+template <class E, class Hash = enum_constants::hash_policy,
+          bool ICase = false>
+constexpr auto enum_hash_seed_v = enum_hash_seed<E, Hash, ICase>();
+
 // Hash collision if either happens:
 // (1) Hash value is zero in some entries;
 // (2) Multiple entries share the same hash value.
-template <class E>
+template <class E, class Hash = enum_constants::hash_policy,
+          bool ICase = false>
 constexpr auto enum_name_has_hash_collision_v =
-  enum_name_has_hash_collision<E>();
+  enum_name_has_hash_collision<E, Hash, ICase>(
+    enum_hash_seed_v<E, Hash, ICase>);
 } // namespace reflect_cpp26::impl
 
 #endif // REFLECT_CPP26_ENUM_IMPL_HASH_COLLISION_CHECK_HPP
@@ -1,8 +1,13 @@
 #ifndef REFLECT_CPP26_TYPE_OPERATIONS_HPP
 #define REFLECT_CPP26_TYPE_OPERATIONS_HPP
 
+#include <reflect_cpp26/type_operations/binary_serialization.hpp>
+#include <reflect_cpp26/type_operations/binary_view.hpp>
 #include <reflect_cpp26/type_operations/comparison.hpp>
 #include <reflect_cpp26/type_operations/define_aggregate.hpp>
+#include <reflect_cpp26/type_operations/from_json.hpp>
+#include <reflect_cpp26/type_operations/soa_vector.hpp>
+#include <reflect_cpp26/type_operations/to_json.hpp>
 #include <reflect_cpp26/type_operations/to_structured.hpp>
 
 #endif // REFLECT_CPP26_TYPE_OPERATIONS_HPP
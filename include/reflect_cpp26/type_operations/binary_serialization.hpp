@@ -0,0 +1,619 @@
+#ifndef REFLECT_CPP26_TYPE_OPERATIONS_BINARY_SERIALIZATION_HPP
+#define REFLECT_CPP26_TYPE_OPERATIONS_BINARY_SERIALIZATION_HPP
+
+#include <reflect_cpp26/type_traits/class_types/flattenable.hpp>
+#include <reflect_cpp26/type_traits/template_instance.hpp>
+#include <reflect_cpp26/type_traits/tuple_like_types.hpp>
+#include <reflect_cpp26/utils/constant.hpp>
+#include <reflect_cpp26/utils/define_static_values.hpp>
+#include <reflect_cpp26/utils/meta_tuple.hpp>
+#include <bit>
+#include <charconv>
+#include <climits>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace reflect_cpp26 {
+namespace impl {
+template <class T>
+consteval bool is_binary_packed();
+
+template <class T>
+consteval bool is_binary_serializable();
+
+template <class T>
+consteval auto binary_fixed_size() -> size_t;
+
+// Size of encoded T if it does not vary with value, or npos otherwise.
+template <class T>
+constexpr auto binary_fixed_size_v =
+  binary_fixed_size<std::remove_cv_t<T>>();
+} // namespace impl
+
+/**
+ * Whether the object representation of T is exactly its value, i.e. T is
+ * (possibly array of) integral, enum or floating-point types without
+ * padding bits (e.g. x87 80-bit long double is excluded), or trivially
+ * copyable flattenable classes whose members are packed recursively without
+ * any padding or bit-field. Values of packed types are copied in bulk.
+ */
+template <class T>
+constexpr auto is_binary_packed_v = impl::is_binary_packed<T>();
+
+template <class T>
+constexpr auto is_binary_serializable_v =
+  impl::is_binary_serializable<std::remove_cv_t<T>>();
+
+/**
+ * Whether T can be serialized with to_binary() and deserialized with
+ * from_binary(), i.e. T is one of the types below (checked in order):
+ *   (1) packed types (see is_binary_packed_v), encoded as their bytes;
+ *   (2) std::optional<U> where U is serializable, encoded as one byte of
+ *       0 or 1 followed by U if present;
+ *   (3) arrays or tuple-like types (e.g. std::pair, std::tuple) whose
+ *       elements are non-const and serializable, encoded elementwise;
+ *   (4) sized ranges with clear() and either emplace_back() (e.g.
+ *       std::vector, std::deque) or contiguous storage with resize() (e.g.
+ *       std::string) whose elements are serializable and not encoded as
+ *       0 bytes (e.g. empty classes), encoded as 64-bit size followed by
+ *       the elements (in bulk if packed and contiguous);
+ *   (5) flattenable class types (see flattenable_class) whose members are
+ *       non-const and serializable. Maximal runs of adjacent packed members
+ *       without padding in between are copied in bulk, and the other
+ *       members are encoded memberwise.
+ * Integers are encoded with native endianness.
+ */
+template <class T>
+concept binary_serializable = is_binary_serializable_v<T>;
+
+namespace impl {
+template <class T>
+concept binary_emplace_back_container =
+  std::ranges::sized_range<T> && requires (T& t) {
+    t.clear();
+    { t.emplace_back() } -> std::same_as<std::ranges::range_value_t<T>&>;
+  };
+
+// Note: std::basic_string has no emplace_back().
+template <class T>
+concept binary_resizable_container =
+  std::ranges::sized_range<T> && std::ranges::contiguous_range<T>
+  && requires (T& t, size_t n) {
+    t.clear();
+    t.resize(n);
+  };
+
+template <class T>
+concept binary_sequence_container =
+  binary_emplace_back_container<T> || binary_resizable_container<T>;
+
+/**
+ * Run of members of T copied in bulk with a single memcpy, or a single
+ * member encoded alone if offset is npos.
+ */
+struct binary_member_run {
+  size_t first;   // Index of the first member in public_flattened_nsdm_v<T>
+  size_t offset;  // Byte offset relative to T
+  size_t size;    // Total bytes of the members in this run
+};
+
+template <class T>
+consteval auto make_binary_member_runs() -> std::vector<binary_member_run>
+{
+  auto res = std::vector<binary_member_run>{};
+  public_flattened_nsdm_v<T>.for_each([&res](auto I, auto spec) {
+    constexpr auto member = spec.value.member;
+    using M = [: type_of(member) :];
+    if constexpr (is_bit_field(member) || !is_binary_packed_v<M>) {
+      res.push_back({.first = I, .offset = npos, .size = 0});
+    } else {
+      auto offset = static_cast<size_t>(spec.value.actual_offset.bytes);
+      if (!res.empty() && res.back().offset != npos
+          && res.back().offset + res.back().size == offset) {
+        res.back().size += sizeof(M); // Adjacent without padding
+      } else {
+        res.push_back({.first = I, .offset = offset, .size = sizeof(M)});
+      }
+    }
+  });
+  return res;
+}
+
+// Whether every bit in the object representation of floating-point type T
+// is a value bit, which is false for x87 80-bit long double.
+template <class T>
+consteval bool floating_point_has_no_padding()
+{
+  using limits = std::numeric_limits<T>;
+  auto exponent_bits = std::bit_width(
+    static_cast<unsigned>(limits::max_exponent - limits::min_exponent));
+  // Sign + exponent + significand without the implicit leading bit
+  auto value_bits = 1 + exponent_bits + (limits::digits - 1);
+  return limits::is_iec559 && value_bits == sizeof(T) * CHAR_BIT;
+}
+
+template <class T>
+consteval bool is_binary_packed()
+{
+  if constexpr (std::is_const_v<T> || std::is_volatile_v<T>) {
+    return false;
+  } else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) {
+    return std::has_unique_object_representations_v<T>;
+  } else if constexpr (std::is_floating_point_v<T>) {
+    return floating_point_has_no_padding<T>();
+  } else if constexpr (std::is_bounded_array_v<T>) {
+    return is_binary_packed_v<std::remove_extent_t<T>>;
+  } else if constexpr (std::is_trivially_copyable_v<T>
+                       && flattenable_class<T>) {
+    // Packed iff all members form a single run that covers the whole T
+    auto runs = make_binary_member_runs<T>();
+    return runs.size() == 1 && runs[0].offset == 0
+      && runs[0].size == sizeof(T);
+  } else {
+    return false;
+  }
+}
+
+template <class T>
+consteval bool is_binary_serializable()
+{
+  if constexpr (is_binary_packed_v<T>) {
+    return true;
+  } else if constexpr (template_instance_of<T, std::optional>) {
+    using U = typename T::value_type;
+    return std::is_default_constructible_v<U> && is_binary_serializable_v<U>;
+  } else if constexpr (std::is_bounded_array_v<T>) {
+    return is_binary_serializable_v<std::remove_extent_t<T>>;
+  } else if constexpr (is_tuple_like_v<T>) {
+    auto res = true;
+    REFLECT_CPP26_EXPAND_I(std::tuple_size_v<T>).for_each([&res](auto I) {
+      using V = std::tuple_element_t<I, T>;
+      return res &= !std::is_const_v<V> && is_binary_serializable_v<V>;
+    });
+    return res;
+  } else if constexpr (binary_sequence_container<T>) {
+    using V = std::ranges::range_value_t<T>;
+    if constexpr (is_binary_serializable_v<V>) {
+      // Each element shall take at least 1 byte so that the size read can
+      // be bounded by the input.
+      return binary_fixed_size_v<V> != 0;
+    } else {
+      return false;
+    }
+  } else if constexpr (flattenable_class<T>) {
+    auto res = true;
+    public_flattened_nsdm_v<T>.for_each([&res](auto spec) {
+      using M = [: type_of(spec.value.member) :];
+      return res &= !std::is_const_v<M> && is_binary_serializable_v<M>;
+    });
+    return res;
+  } else {
+    return false;
+  }
+}
+
+template <class T>
+constexpr auto binary_member_runs_v =
+  reflect_cpp26::define_static_array(make_binary_member_runs<T>());
+
+constexpr auto add_binary_fixed_size(size_t x, size_t y) -> size_t {
+  return (x == npos || y == npos) ? npos : x + y;
+}
+
+/**
+ * Offset of each member of public_flattened_nsdm_v<T> in encoded T, which
+ * is npos if it follows any member whose encoded size varies with value.
+ * Note that padding between runs is removed by encoding.
+ */
+template <class T>
+consteval auto make_binary_member_encoded_offsets() -> std::vector<size_t>
+{
+  auto res = std::vector<size_t>{};
+  auto pos = 0zU;
+  public_flattened_nsdm_v<T>.for_each([&res, &pos](auto spec) {
+    using M = [: type_of(spec.value.member) :];
+    res.push_back(pos);
+    pos = add_binary_fixed_size(pos, binary_fixed_size_v<M>);
+  });
+  return res;
+}
+
+template <class T>
+constexpr auto binary_member_encoded_offsets_v =
+  reflect_cpp26::define_static_array(make_binary_member_encoded_offsets<T>());
+
+template <class T>
+consteval auto binary_fixed_size() -> size_t
+{
+  if constexpr (is_binary_packed_v<T>) {
+    return sizeof(T);
+  } else if constexpr (template_instance_of<T, std::optional>) {
+    return npos;
+  } else if constexpr (std::is_bounded_array_v<T>) {
+    constexpr auto elem_size = binary_fixed_size_v<std::remove_extent_t<T>>;
+    return (elem_size == npos) ? npos : elem_size * std::extent_v<T>;
+  } else if constexpr (is_tuple_like_v<T>) {
+    auto res = 0zU;
+    REFLECT_CPP26_EXPAND_I(std::tuple_size_v<T>).for_each([&res](auto I) {
+      using V = std::tuple_element_t<I, T>;
+      res = add_binary_fixed_size(res, binary_fixed_size_v<V>);
+    });
+    return res;
+  } else if constexpr (binary_sequence_container<T>) {
+    return npos;
+  } else {
+    auto res = 0zU;
+    public_flattened_nsdm_v<T>.for_each([&res](auto spec) {
+      using M = [: type_of(spec.value.member) :];
+      res = add_binary_fixed_size(res, binary_fixed_size_v<M>);
+    });
+    return res;
+  }
+}
+
+// FNV-1a over the 8 bytes of v.
+constexpr auto binary_fingerprint_mix(uint64_t h, uint64_t v) -> uint64_t
+{
+  for (auto i = 0; i < 8; i++) {
+    h = (h ^ ((v >> (i * 8)) & 0xFF)) * 0x0000'0100'0000'01B3zU;
+  }
+  return h;
+}
+
+enum class binary_layout_tag : uint64_t {
+  integral = 1, floating_point, enumeration, optional, array, tuple, range,
+  object,
+};
+
+// Mixes layout of T into h: encoding scheme, sizes and offsets of T and
+// its subobjects, recursively. Names are irrelevant.
+template <class T>
+consteval auto mix_binary_layout(uint64_t h) -> uint64_t
+{
+  auto mix_tag = [&h](binary_layout_tag tag) {
+    h = binary_fingerprint_mix(h, std::to_underlying(tag));
+  };
+  h = binary_fingerprint_mix(h, sizeof(T));
+  h = binary_fingerprint_mix(h, alignof(T));
+  if constexpr (std::is_integral_v<T>) {
+    mix_tag(binary_layout_tag::integral);
+    h = binary_fingerprint_mix(h, std::is_signed_v<T>);
+  } else if constexpr (std::is_floating_point_v<T>) {
+    mix_tag(binary_layout_tag::floating_point);
+  } else if constexpr (std::is_enum_v<T>) {
+    mix_tag(binary_layout_tag::enumeration);
+    h = mix_binary_layout<std::underlying_type_t<T>>(h);
+  } else if constexpr (template_instance_of<T, std::optional>) {
+    mix_tag(binary_layout_tag::optional);
+    h = mix_binary_layout<typename T::value_type>(h);
+  } else if constexpr (std::is_bounded_array_v<T>) {
+    mix_tag(binary_layout_tag::array);
+    h = binary_fingerprint_mix(h, std::extent_v<T>);
+    h = mix_binary_layout<std::remove_extent_t<T>>(h);
+  } else if constexpr (is_tuple_like_v<T> && !is_binary_packed_v<T>) {
+    mix_tag(binary_layout_tag::tuple);
+    h = binary_fingerprint_mix(h, std::tuple_size_v<T>);
+    REFLECT_CPP26_EXPAND_I(std::tuple_size_v<T>).for_each([&h](auto I) {
+      h = mix_binary_layout<std::tuple_element_t<I, T>>(h);
+    });
+  } else if constexpr (binary_sequence_container<T>) {
+    mix_tag(binary_layout_tag::range);
+    h = mix_binary_layout<std::ranges::range_value_t<T>>(h);
+  } else {
+    mix_tag(binary_layout_tag::object);
+    h = binary_fingerprint_mix(h, public_flattened_nsdm_v<T>.size());
+    public_flattened_nsdm_v<T>.for_each([&h](auto spec) {
+      constexpr auto member = spec.value.member;
+      auto offset = spec.value.actual_offset;
+      h = binary_fingerprint_mix(h, static_cast<uint64_t>(offset.bytes));
+      h = binary_fingerprint_mix(h, static_cast<uint64_t>(offset.bits));
+      if constexpr (is_bit_field(member)) {
+        h = binary_fingerprint_mix(h, bit_size_of(member));
+      }
+      h = mix_binary_layout<std::remove_cv_t<[: type_of(member) :]>>(h);
+    });
+  }
+  return h;
+}
+
+// Version of the encoding scheme, bumped on incompatible changes.
+constexpr uint64_t binary_format_version = 1;
+
+template <class T>
+consteval auto make_binary_layout_fingerprint() -> uint64_t
+{
+  constexpr auto fnv_offset_basis = 0xCBF2'9CE4'8422'2325zU;
+  auto h = binary_fingerprint_mix(fnv_offset_basis, binary_format_version);
+  h = binary_fingerprint_mix(h, std::endian::native == std::endian::little);
+  return mix_binary_layout<T>(h);
+}
+} // namespace impl
+
+/**
+ * Layout fingerprint of T, which is written as the header of each message
+ * by append_binary() and checked by from_binary(). It changes if sizes,
+ * offsets or encoding of T or any of its subobjects change, or if
+ * endianness differs. Renaming members does not change the fingerprint.
+ */
+template <binary_serializable T>
+constexpr auto binary_layout_fingerprint_v =
+  impl::make_binary_layout_fingerprint<std::remove_cv_t<T>>();
+
+namespace impl {
+inline void append_binary_bytes(
+  std::string& out, const void* data, size_t size)
+{
+  out.append(static_cast<const char*>(data), size);
+}
+
+template <class T>
+void append_binary_value(std::string& out, const T& value);
+
+template <class T>
+void append_binary_object(std::string& out, const T& value)
+{
+  const auto* base = reinterpret_cast<const char*>(std::addressof(value));
+  REFLECT_CPP26_EXPAND(binary_member_runs_v<T>).for_each(
+    [&out, &value, base](auto run) {
+      if constexpr (run.value.offset != npos) {
+        append_binary_bytes(out, base + run.value.offset, run.value.size);
+      } else {
+        constexpr auto member =
+          public_flattened_nsdm_v<T>.values[run.value.first].member;
+        append_binary_value(out, value.[: member :]);
+      }
+    });
+}
+
+template <class T>
+void append_binary_value(std::string& out, const T& value)
+{
+  if constexpr (is_binary_packed_v<T>) {
+    append_binary_bytes(out, std::addressof(value), sizeof(T));
+  } else if constexpr (template_instance_of<T, std::optional>) {
+    out += static_cast<char>(value.has_value());
+    if (value.has_value()) {
+      append_binary_value(out, *value);
+    }
+  } else if constexpr (std::is_bounded_array_v<T>) {
+    for (const auto& elem: value) {
+      append_binary_value(out, elem);
+    }
+  } else if constexpr (is_tuple_like_v<T>) {
+    REFLECT_CPP26_EXPAND_I(std::tuple_size_v<T>).for_each(
+      [&out, &value](auto I) {
+        append_binary_value(out, tuple_get<I>(value));
+      });
+  } else if constexpr (binary_sequence_container<T>) {
+    using V = std::ranges::range_value_t<T>;
+    auto size = static_cast<uint64_t>(std::ranges::size(value));
+    append_binary_bytes(out, &size, sizeof(size));
+    if constexpr (is_binary_packed_v<V> && std::ranges::contiguous_range<T>) {
+      append_binary_bytes(out, std::ranges::data(value), size * sizeof(V));
+    } else {
+      for (const auto& elem: value) {
+        append_binary_value(out, elem);
+      }
+    }
+  } else if constexpr (flattenable_class<T>) {
+    append_binary_object(out, value);
+  } else {
+    static_assert(false, "Invalid type.");
+  }
+}
+
+/**
+ * Reads from [cur, end). Each read function returns false on failure with
+ * ec set and cur pointing to where the failure occurs.
+ */
+struct binary_reader {
+  const char* cur;
+  const char* end;
+  std::errc ec = {};
+
+  auto fail(std::errc e = std::errc::invalid_argument) -> bool
+  {
+    ec = e;
+    return false;
+  }
+
+  auto remaining() const -> size_t {
+    return static_cast<size_t>(end - cur);
+  }
+
+  auto read_bytes(void* dest, size_t size) -> bool
+  {
+    if (size > remaining()) {
+      return fail();
+    }
+    if (size != 0) {
+      std::memcpy(dest, cur, size);
+      cur += size;
+    }
+    return true;
+  }
+};
+
+template <class T>
+auto read_binary_value(binary_reader& r, T& value) -> bool;
+
+template <class T>
+auto read_binary_object(binary_reader& r, T& value) -> bool
+{
+  auto* base = reinterpret_cast<char*>(std::addressof(value));
+  auto res = true;
+  REFLECT_CPP26_EXPAND(binary_member_runs_v<T>).for_each(
+    [&r, &value, &res, base](auto run) {
+      constexpr auto member =
+        public_flattened_nsdm_v<T>.values[run.value.first].member;
+      if constexpr (run.value.offset != npos) {
+        res = r.read_bytes(base + run.value.offset, run.value.size);
+      } else if constexpr (is_bit_field(member)) {
+        using M = [: type_of(member) :];
+        auto temp = M{};
+        res = read_binary_value(r, temp);
+        value.[: member :] = temp;
+      } else {
+        res = read_binary_value(r, value.[: member :]);
+      }
+      return /* continues if */ res;
+    });
+  return res;
+}
+
+template <class T>
+auto read_binary_value(binary_reader& r, T& value) -> bool
+{
+  if constexpr (is_binary_packed_v<T>) {
+    return r.read_bytes(std::addressof(value), sizeof(T));
+  } else if constexpr (template_instance_of<T, std::optional>) {
+    auto flag = char{};
+    if (!r.read_bytes(&flag, 1)) {
+      return false;
+    }
+    if (flag == 0) {
+      value.reset();
+      return true;
+    }
+    if (flag != 1) {
+      r.cur -= 1;
+      return r.fail();
+    }
+    return read_binary_value(r, value.emplace());
+  } else if constexpr (std::is_bounded_array_v<T>) {
+    for (auto& elem: value) {
+      if (!read_binary_value(r, elem)) {
+        return false;
+      }
+    }
+    return true;
+  } else if constexpr (is_tuple_like_v<T>) {
+    auto res = true;
+    REFLECT_CPP26_EXPAND_I(std::tuple_size_v<T>).for_each(
+      [&r, &value, &res](auto I) {
+        res = read_binary_value(r, tuple_get<I>(value));
+        return /* continues if */ res;
+      });
+    return res;
+  } else if constexpr (binary_sequence_container<T>) {
+    using V = std::ranges::range_value_t<T>;
+    auto size = uint64_t{};
+    if (!r.read_bytes(&size, sizeof(size))) {
+      return false;
+    }
+    if constexpr (is_binary_packed_v<V> && binary_resizable_container<T>) {
+      // Rejects sizes beyond the input before allocating
+      if (size > r.remaining() / sizeof(V)) {
+        r.cur -= sizeof(size);
+        return r.fail();
+      }
+      value.resize(size);
+      return r.read_bytes(std::ranges::data(value), size * sizeof(V));
+    } else {
+      // Each element takes at least 1 byte (see binary_serializable)
+      if (size > r.remaining()) {
+        r.cur -= sizeof(size);
+        return r.fail();
+      }
+      value.clear();
+      if constexpr (binary_emplace_back_container<T>) {
+        if constexpr (requires { value.reserve(size); }) {
+          value.reserve(size);
+        }
+        for (auto i = uint64_t{0}; i < size; i++) {
+          if (!read_binary_value(r, value.emplace_back())) {
+            return false;
+          }
+        }
+      } else {
+        value.resize(size);
+        for (auto& elem: value) {
+          if (!read_binary_value(r, elem)) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+  } else if constexpr (flattenable_class<T>) {
+    return read_binary_object(r, value);
+  } else {
+    static_assert(false, "Invalid type.");
+  }
+}
+} // namespace impl
+
+/**
+ * Appends a message of value to out, which consists of the layout
+ * fingerprint of T (see binary_layout_fingerprint_v) followed by the
+ * encoded value (see binary_serializable). Flat structs of arithmetic
+ * members are encoded with a single memcpy.
+ */
+template <binary_serializable T>
+void append_binary(std::string& out, const T& value)
+{
+  constexpr uint64_t fingerprint = binary_layout_fingerprint_v<T>;
+  impl::append_binary_bytes(out, &fingerprint, sizeof(fingerprint));
+  impl::append_binary_value(out, value);
+}
+
+template <binary_serializable T>
+auto to_binary(const T& value) -> std::string
+{
+  auto res = std::string{};
+  append_binary(res, value);
+  return res;
+}
+
+/**
+ * Decodes a message made by append_binary() from [first, last) into value.
+ * Similar to std::from_chars, ptr of the result points to the first byte
+ * after the message on success, or where the failure occurs otherwise,
+ * with ec set to:
+ *   - std::errc::protocol_error if the layout fingerprint mismatches;
+ *   - std::errc::invalid_argument if the message is truncated or malformed.
+ * value may be partially modified on failure. Note that values of packed
+ * types are not validated (e.g. enums and bools), thus messages should
+ * come from trusted sources with the same layout.
+ */
+template <binary_serializable T>
+auto from_binary(const char* first, const char* last, T& value)
+  -> std::from_chars_result
+{
+  auto reader = impl::binary_reader{.cur = first, .end = last};
+  auto fingerprint = uint64_t{};
+  if (!reader.read_bytes(&fingerprint, sizeof(fingerprint))) {
+    return {first, reader.ec};
+  }
+  if (fingerprint != binary_layout_fingerprint_v<T>) {
+    return {first, std::errc::protocol_error};
+  }
+  impl::read_binary_value(reader, value);
+  return {reader.cur, reader.ec};
+}
+
+/**
+ * Decodes the whole data as a single message into a value-initialized T.
+ * Returns std::nullopt on failure.
+ */
+template <binary_serializable T>
+  requires (std::is_default_constructible_v<T>)
+auto from_binary(std::string_view data) -> std::optional<T>
+{
+  auto res = std::optional<T>{std::in_place};
+  const auto* last = data.data() + data.size();
+  auto [ptr, ec] = from_binary(data.data(), last, *res);
+  if (ec != std::errc{} || ptr != last) {
+    return std::nullopt;
+  }
+  return res;
+}
+} // namespace reflect_cpp26
+
+#endif // REFLECT_CPP26_TYPE_OPERATIONS_BINARY_SERIALIZATION_HPP
@@ -0,0 +1,175 @@
+#ifndef REFLECT_CPP26_TYPE_OPERATIONS_BINARY_VIEW_HPP
+#define REFLECT_CPP26_TYPE_OPERATIONS_BINARY_VIEW_HPP
+
+#include <reflect_cpp26/type_operations/binary_serialization.hpp>
+#include <reflect_cpp26/type_operations/define_aggregate.hpp>
+#include <reflect_cpp26/utils/meta_utility.hpp>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <utility>
+
+namespace reflect_cpp26 {
+/**
+ * Whether view_of<T> is available, i.e. T is a binary serializable
+ * (see binary_serializable) flattenable class whose encoded size does not
+ * vary with value (e.g. no string, range or std::optional inside).
+ */
+template <class T>
+concept binary_viewable = binary_serializable<T> && flattenable_class<T>
+  && impl::binary_fixed_size_v<T> != npos;
+
+/**
+ * Lazy accessor of a member whose encoded value starts at compile-time
+ * Offset from base. The value is loaded only when get() is called.
+ */
+template <class T, size_t Offset>
+struct binary_value_view {
+  using value_type = T;
+  static constexpr auto offset = Offset;
+
+  const std::byte* base;
+
+  auto get() const -> T
+  {
+    if constexpr (is_binary_packed_v<T>) {
+      T res; // Fully overwritten by memcpy
+      std::memcpy(&res, base + Offset, sizeof(T));
+      return res;
+    } else {
+      const auto* first = reinterpret_cast<const char*>(base + Offset);
+      auto reader = impl::binary_reader{
+        .cur = first, .end = first + impl::binary_fixed_size_v<T>};
+      auto res = T{};
+      impl::read_binary_value(reader, res);
+      return res;
+    }
+  }
+
+  operator T() const {
+    return get();
+  }
+};
+
+namespace impl {
+// Members of such class types are viewed recursively.
+template <class T>
+constexpr auto is_binary_view_nested_v =
+  flattenable_class<T> && !is_binary_packed_v<T> && !is_tuple_like_v<T>;
+
+template <class T>
+struct binary_view_transform {
+  static consteval auto operator()(flattened_data_member_spec spec)
+    -> std::meta::info;
+};
+} // namespace impl
+
+/**
+ * Zero-copy view of encoded T (see binary_serializable), which is an
+ * aggregate with the same member names as public_flattened_nsdm_v<T>.
+ * Each member of view_of<T> is either:
+ *   (1) view_of<M> if M is a non-packed flattenable class that is not
+ *       tuple-like, which views the nested members recursively;
+ *   (2) binary_value_view<M, offset> otherwise, whose offset is
+ *       the position of the member in encoded T.
+ * Member names of T shall be unique.
+ */
+template <binary_viewable T>
+using view_of = aggregate_by_flattened_memberwise_t<
+  impl::binary_view_transform<std::remove_cv_t<T>>, T>;
+
+/**
+ * Size of encoded T in bytes, which is also the stride of consecutive
+ * records of T, e.g. elements of encoded std::vector<T>.
+ */
+template <binary_viewable T>
+constexpr auto binary_view_size_v = impl::binary_fixed_size_v<T>;
+
+namespace impl {
+template <class T>
+consteval auto binary_view_transform<T>::operator()(
+  flattened_data_member_spec spec) -> std::meta::info
+{
+  auto specs = public_flattened_nsdm_v<T>.to_vector();
+  auto index = npos;
+  for (auto i = 0zU, n = specs.size(); i < n; i++) {
+    if (specs[i].member == spec.member
+        && specs[i].actual_offset.bytes == spec.actual_offset.bytes) {
+      index = i;
+      break;
+    }
+  }
+  auto type = remove_cv(type_of(spec.member));
+  auto view_type = extract_bool(^^is_binary_view_nested_v, type)
+    ? reflect_cpp26::substitute(^^view_of, type)
+    : reflect_cpp26::substitute(^^binary_value_view, type,
+        std::meta::reflect_value(binary_member_encoded_offsets_v<T>[index]));
+  return data_member_spec(view_type, {.name = identifier_of(spec.member)});
+}
+
+template <class T>
+constexpr auto make_binary_view(const std::byte* base) -> view_of<T>;
+
+template <class T, size_t I>
+constexpr auto make_binary_view_member(const std::byte* base)
+{
+  constexpr auto member = public_flattened_nsdm_v<T>.values[I].member;
+  constexpr auto offset = binary_member_encoded_offsets_v<T>[I];
+  using M = std::remove_cv_t<[: type_of(member) :]>;
+  if constexpr (is_binary_view_nested_v<M>) {
+    return make_binary_view<M>(base + offset);
+  } else {
+    return binary_value_view<M, offset>{base};
+  }
+}
+
+template <class T, size_t... Is>
+constexpr auto make_binary_view_by_members(
+  const std::byte* base, std::index_sequence<Is...>) -> view_of<T>
+{
+  return {make_binary_view_member<T, Is>(base)...};
+}
+
+template <class T>
+constexpr auto make_binary_view(const std::byte* base) -> view_of<T>
+{
+  return make_binary_view_by_members<T>(base,
+    std::make_index_sequence<public_flattened_nsdm_v<T>.size()>{});
+}
+} // namespace impl
+
+/**
+ * Makes view of encoded T in bytes without reading any member.
+ * Precondition: bytes.size() >= binary_view_size_v<T>, and bytes is encoded
+ * T without header, e.g. a record inside a mapped file.
+ */
+template <binary_viewable T>
+constexpr auto make_view(std::span<const std::byte> bytes) -> view_of<T> {
+  return impl::make_binary_view<std::remove_cv_t<T>>(bytes.data());
+}
+
+/**
+ * Makes view of a whole message made by append_binary() (see
+ * binary_serialization.hpp). Returns std::nullopt if the layout fingerprint
+ * or message size mismatches.
+ */
+template <binary_viewable T>
+auto view_binary(std::string_view message) -> std::optional<view_of<T>>
+{
+  constexpr auto header_size = sizeof(uint64_t);
+  if (message.size() != header_size + binary_view_size_v<T>) {
+    return std::nullopt;
+  }
+  auto fingerprint = uint64_t{};
+  std::memcpy(&fingerprint, message.data(), header_size);
+  if (fingerprint != binary_layout_fingerprint_v<T>) {
+    return std::nullopt;
+  }
+  const auto* bytes = reinterpret_cast<const std::byte*>(message.data());
+  return impl::make_binary_view<std::remove_cv_t<T>>(bytes + header_size);
+}
+} // namespace reflect_cpp26
+
+#endif // REFLECT_CPP26_TYPE_OPERATIONS_BINARY_VIEW_HPP
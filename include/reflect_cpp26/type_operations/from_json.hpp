@@ -0,0 +1,803 @@
+#ifndef REFLECT_CPP26_TYPE_OPERATIONS_FROM_JSON_HPP
+#define REFLECT_CPP26_TYPE_OPERATIONS_FROM_JSON_HPP
+
+#include <reflect_cpp26/annotations/properties.hpp>
+#include <reflect_cpp26/enum/impl/enum_hash_entry_search.hpp>
+#include <reflect_cpp26/enum/enum_cast.hpp>
+#include <reflect_cpp26/enum/enum_names.hpp>
+#include <reflect_cpp26/type_traits/arithmetic_types.hpp>
+#include <reflect_cpp26/type_traits/class_types/flattenable.hpp>
+#include <reflect_cpp26/type_traits/template_instance.hpp>
+#include <reflect_cpp26/type_traits/tuple_like_types.hpp>
+#include <reflect_cpp26/type_traits/type_comparison.hpp>
+#include <reflect_cpp26/utils/define_static_values.hpp>
+#include <reflect_cpp26/utils/meta_tuple.hpp>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <limits>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace reflect_cpp26 {
+namespace impl {
+template <class T>
+consteval bool is_json_deserializable();
+} // namespace impl
+
+template <class T>
+constexpr auto is_json_deserializable_v =
+  impl::is_json_deserializable<std::remove_cv_t<T>>();
+
+/**
+ * Whether T can be deserialized with from_json(), i.e. T is one of the types
+ * below (checked in order):
+ *   (1) bool;
+ *   (2) char, from a string of length 1;
+ *   (3) integer types (see integer_type) and floating-point types,
+ *       where null is accepted as NaN for floating-point types;
+ *   (4) enum types, from enum name string (via enum_cast) or integer;
+ *   (5) std::string, or char arrays from strings that fit in the array
+ *       (the rest of the array is filled with '\0');
+ *   (6) std::optional<U> where U is deserializable, from null or U;
+ *   (7) arrays or tuple-like types (e.g. std::array, std::pair, std::tuple)
+ *       whose elements are deserializable, from JSON arrays of exact size;
+ *   (8) containers with clear() and emplace_back() (e.g. std::vector)
+ *       whose elements are deserializable, from JSON arrays;
+ *   (9) flattenable class types (see flattenable_class) whose members are
+ *       non-const and deserializable, from JSON objects. Key of each member
+ *       is its identifier, or rename_t property annotated to the member if
+ *       any, plus all its aliases_t property values. Members whose keys are
+ *       absent are left untouched, and unknown keys are skipped.
+ */
+template <class T>
+concept json_deserializable = is_json_deserializable_v<T>;
+
+namespace impl {
+template <class T>
+constexpr auto is_json_char_array_target_v =
+  std::is_array_v<T> && std::is_same_v<std::remove_extent_t<T>, char>;
+
+template <class T>
+concept json_emplace_back_container = requires (T& t) {
+  t.clear();
+  { t.emplace_back() } -> std::same_as<std::ranges::range_value_t<T>&>;
+};
+
+template <class T>
+consteval bool is_json_deserializable()
+{
+  if constexpr (same_as_one_of<T, bool, char, std::string>
+      || integer_type<T> || std::is_floating_point_v<T>
+      || std::is_enum_v<T> || is_json_char_array_target_v<T>) {
+    return true;
+  } else if constexpr (template_instance_of<T, std::optional>) {
+    using U = typename T::value_type;
+    return std::is_default_constructible_v<U> && is_json_deserializable_v<U>;
+  } else if constexpr (std::is_bounded_array_v<T>) {
+    return is_json_deserializable_v<std::remove_extent_t<T>>;
+  } else if constexpr (is_tuple_like_v<T>) {
+    auto res = true;
+    REFLECT_CPP26_EXPAND_I(std::tuple_size_v<T>).for_each([&res](auto I) {
+      using V = std::tuple_element_t<I, T>;
+      return res &= !std::is_const_v<V> && is_json_deserializable_v<V>;
+    });
+    return res;
+  } else if constexpr (json_emplace_back_container<T>) {
+    return is_json_deserializable_v<std::ranges::range_value_t<T>>;
+  } else if constexpr (flattenable_class<T>) {
+    auto res = true;
+    public_flattened_nsdm_v<T>.for_each([&res](auto spec) {
+      using M = [: type_of(spec.value.member) :];
+      return res &= !std::is_const_v<M> && is_json_deserializable_v<M>;
+    });
+    return res;
+  } else {
+    return false;
+  }
+}
+
+// Keys of JSON objects are hashed with the same policy as enum names.
+using json_key_hash_policy = enum_constants::hash_policy;
+
+/**
+ * Key -> member index of class T. Keys are dispatched with a minimal
+ * perfect hash table (see enum_hash_perfect_table), or with binary search
+ * among hash values if hash collision exists.
+ */
+struct json_key_table {
+  meta_span<enum_hash_entry> entries; // Sorted by hash value
+  enum_hash_entry_pool pool;
+  enum_hash_perfect_table perfect_table; // Empty on hash collision
+  size_t max_key_size;
+
+  // Returns the member index, or npos if not found.
+  constexpr auto find(std::string_view key) const -> size_t
+  {
+    if (key.empty() || key.size() > max_key_size) {
+      return npos;
+    }
+    auto hash = json_key_hash_policy::operator()(key, 0);
+    const uint64_t* pos = nullptr;
+    if (!perfect_table.entries.empty()) {
+      pos = enum_hash_perfect_table_search(perfect_table, pool, key, hash);
+    } else {
+      pos = enum_hash_entry_value(
+        enum_hash_binary_search_with_collision(entries, key, hash));
+    }
+    return (pos == nullptr) ? npos : static_cast<size_t>(*pos);
+  }
+};
+
+template <class T>
+consteval auto make_json_key_entry_list() -> std::vector<enum_hash_entry>
+{
+  auto res = std::vector<enum_hash_entry>{};
+  auto add_key = [&res](std::string_view key, size_t index) {
+    if (key.empty()) {
+      compile_error("Keys of JSON objects can not be empty.");
+    }
+    res.push_back({
+      .name_hash = json_key_hash_policy::operator()(key, 0),
+      .value = index,
+      .name = reflect_cpp26::define_static_string(key),
+    });
+  };
+  public_flattened_nsdm_v<T>.for_each([&add_key](auto I, auto spec) {
+    constexpr auto member = spec.value.member;
+    constexpr auto rename = annotations::impl::find_annotation_of_type(
+      ^^annotations::rename_t, member);
+    constexpr auto aliases = annotations::impl::find_annotation_of_type(
+      ^^annotations::aliases_t, member);
+    if constexpr (std::meta::info{} == rename) {
+      add_key(identifier_of(member), I);
+    } else {
+      add_key(extract<annotations::rename_t>(rename).value, I);
+    }
+    if constexpr (std::meta::info{} != aliases) {
+      for (auto alias: extract<annotations::aliases_t>(aliases).value) {
+        add_key(alias, I);
+      }
+    }
+  });
+  std::ranges::sort(res, &enum_hash_entry::less_by_hash_strong_order);
+  auto pos = std::ranges::adjacent_find(res, {}, &enum_hash_entry::name);
+  if (res.end() != pos) {
+    compile_error("Duplicated keys detected.");
+  }
+  return res;
+}
+
+template <class T>
+consteval auto make_json_key_table() -> json_key_table
+{
+  auto entries = make_json_key_entry_list<T>();
+  auto has_collision = entries.end() != std::ranges::adjacent_find(
+    entries, {}, &enum_hash_entry::name_hash);
+
+  auto res = json_key_table{
+    .entries = reflect_cpp26::define_static_array(entries),
+    .pool = make_enum_hash_entry_pool(entries),
+    .max_key_size = 0,
+  };
+  for (const auto& e: entries) {
+    res.max_key_size = std::max(res.max_key_size, e.name.size());
+  }
+  if (!entries.empty() && !has_collision) {
+    res.perfect_table = make_enum_hash_perfect_table(
+      make_enum_packed_hash_entry_list(entries));
+  }
+  return res;
+}
+
+template <class T>
+constexpr auto json_key_table_v = make_json_key_table<T>();
+
+// Nesting limit of values skipped (i.e. of unknown keys).
+constexpr size_t json_max_skip_depth = 256;
+
+/**
+ * Single-pass JSON scanner without DOM. Each read function returns false
+ * on failure, with ec set and cur pointing to where the failure occurs.
+ */
+struct json_reader {
+  const char* cur;
+  const char* end;
+  std::errc ec = {};
+
+  constexpr auto fail(std::errc e = std::errc::invalid_argument) -> bool
+  {
+    ec = e;
+    return false;
+  }
+
+  constexpr void skip_whitespaces()
+  {
+    while (cur < end
+        && (*cur == ' ' || *cur == '\n' || *cur == '\r' || *cur == '\t')) {
+      ++cur;
+    }
+  }
+
+  // Returns -1 if end of input is reached.
+  constexpr auto peek() -> int
+  {
+    skip_whitespaces();
+    return (cur < end) ? static_cast<unsigned char>(*cur) : -1;
+  }
+
+  constexpr auto consume(char c) -> bool
+  {
+    if (peek() != static_cast<unsigned char>(c)) {
+      return false;
+    }
+    ++cur;
+    return true;
+  }
+
+  constexpr auto expect(char c) -> bool {
+    return consume(c) || fail();
+  }
+
+  constexpr auto consume_literal(std::string_view literal) -> bool
+  {
+    skip_whitespaces();
+    if (!std::string_view{cur, end}.starts_with(literal)) {
+      return false;
+    }
+    cur += literal.size();
+    return true;
+  }
+
+  // raw: content between quotation marks with escape sequences kept
+  constexpr auto read_raw_string(std::string_view& raw, bool& has_escape)
+    -> bool
+  {
+    if (!expect('"')) {
+      return false;
+    }
+    const auto* head = cur;
+    has_escape = false;
+    for (; cur < end; ++cur) {
+      auto c = static_cast<unsigned char>(*cur);
+      if (c == '"') {
+        raw = std::string_view{head, cur++};
+        return true;
+      }
+      if (c == '\\') {
+        has_escape = true;
+        if (++cur == end) {
+          break;
+        }
+      } else if (c < 0x20) {
+        return fail();
+      }
+    }
+    return fail();
+  }
+
+  // Characters of JSON numbers, validated later by std::from_chars.
+  constexpr auto read_number_token(std::string_view& token) -> bool
+  {
+    skip_whitespaces();
+    const auto* head = cur;
+    for (; cur < end; ++cur) {
+      auto c = *cur;
+      if (!(('0' <= c && c <= '9')
+          || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E')) {
+        break;
+      }
+    }
+    token = std::string_view{head, cur};
+    return !token.empty() || fail();
+  }
+
+  constexpr auto skip_value(size_t depth = 0) -> bool;
+};
+
+// Reads 4 hex digits of \uXXXX.
+constexpr auto parse_json_hex4(std::string_view str, uint32_t& res) -> bool
+{
+  if (str.size() < 4) {
+    return false;
+  }
+  res = 0;
+  for (auto i = 0zU; i < 4; i++) {
+    auto c = str[i];
+    auto digit = ('0' <= c && c <= '9') ? c - '0'
+      : ('a' <= c && c <= 'f') ? c - 'a' + 10
+      : ('A' <= c && c <= 'F') ? c - 'A' + 10
+      : -1;
+    if (digit < 0) {
+      return false;
+    }
+    res = res * 16 + static_cast<uint32_t>(digit);
+  }
+  return true;
+}
+
+// Precondition: code_point <= 0x10FFFF. Returns the number of bytes.
+constexpr auto encode_utf8(uint32_t code_point, char* out) -> size_t
+{
+  if (code_point < 0x80) {
+    out[0] = static_cast<char>(code_point);
+    return 1;
+  }
+  if (code_point < 0x800) {
+    out[0] = static_cast<char>(0xC0 | (code_point >> 6));
+    out[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+    return 2;
+  }
+  if (code_point < 0x10000) {
+    out[0] = static_cast<char>(0xE0 | (code_point >> 12));
+    out[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+    out[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+    return 3;
+  }
+  out[0] = static_cast<char>(0xF0 | (code_point >> 18));
+  out[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+  out[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+  out[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+  return 4;
+}
+
+/**
+ * Decodes escape sequences in raw (see json_reader::read_raw_string).
+ * Decoded pieces are passed to append(const char*, size_t).
+ * Returns false if raw contains invalid escape sequences.
+ */
+template <class AppendFn>
+constexpr auto unescape_json_string(std::string_view raw, AppendFn&& append)
+  -> bool
+{
+  auto run_head = 0zU;
+  for (auto i = 0zU, n = raw.size(); i < n; ) {
+    if (raw[i] != '\\') {
+      i += 1;
+      continue;
+    }
+    append(raw.data() + run_head, i - run_head);
+    if (i + 1 >= n) {
+      return false;
+    }
+    auto c = raw[i + 1];
+    i += 2;
+    switch (c) {
+      case '"':  append("\"", 1); break;
+      case '\\': append("\\", 1); break;
+      case '/':  append("/", 1); break;
+      case 'b':  append("\b", 1); break;
+      case 'f':  append("\f", 1); break;
+      case 'n':  append("\n", 1); break;
+      case 'r':  append("\r", 1); break;
+      case 't':  append("\t", 1); break;
+      case 'u': {
+        auto code_point = uint32_t{};
+        if (!parse_json_hex4(raw.substr(i), code_point)) {
+          return false;
+        }
+        i += 4;
+        if (0xDC00 <= code_point && code_point <= 0xDFFF) {
+          return false; // Unpaired low surrogate
+        }
+        if (0xD800 <= code_point && code_point <= 0xDBFF) {
+          auto low = uint32_t{};
+          if (!raw.substr(i).starts_with("\\u")
+              || !parse_json_hex4(raw.substr(i + 2), low)
+              || !(0xDC00 <= low && low <= 0xDFFF)) {
+            return false;
+          }
+          i += 6;
+          code_point = 0x10000 + ((code_point - 0xD800) << 10)
+            + (low - 0xDC00);
+        }
+        char utf8[4];
+        append(utf8, encode_utf8(code_point, utf8));
+        break;
+      }
+      default:
+        return false;
+    }
+    run_head = i;
+  }
+  append(raw.data() + run_head, raw.size() - run_head);
+  return true;
+}
+
+constexpr auto json_reader::skip_value(size_t depth) -> bool
+{
+  if (depth >= json_max_skip_depth) {
+    return fail();
+  }
+  auto raw = std::string_view{};
+  auto has_escape = false;
+  switch (peek()) {
+    case '"':
+      return read_raw_string(raw, has_escape);
+    case '{':
+      ++cur;
+      if (consume('}')) {
+        return true;
+      }
+      do {
+        if (!read_raw_string(raw, has_escape) || !expect(':')
+            || !skip_value(depth + 1)) {
+          return false;
+        }
+      } while (consume(','));
+      return expect('}');
+    case '[':
+      ++cur;
+      if (consume(']')) {
+        return true;
+      }
+      do {
+        if (!skip_value(depth + 1)) {
+          return false;
+        }
+      } while (consume(','));
+      return expect(']');
+    case 't':
+      return consume_literal("true") || fail();
+    case 'f':
+      return consume_literal("false") || fail();
+    case 'n':
+      return consume_literal("null") || fail();
+    default:
+      return read_number_token(raw);
+  }
+}
+
+/**
+ * Reads a string which is only compared (keys and enum names) without
+ * allocation: raw content if no escape sequence exists, or decoded into
+ * buffer otherwise. Decoded strings longer than buffer are truncated to
+ * exactly buffer.size() characters, which shall be longer than any
+ * string compared with.
+ */
+template <size_t N>
+constexpr auto read_json_short_string(
+  json_reader& r, std::array<char, N>& buffer, std::string_view& res) -> bool
+{
+  auto raw = std::string_view{};
+  auto has_escape = false;
+  if (!r.read_raw_string(raw, has_escape)) {
+    return false;
+  }
+  if (!has_escape) {
+    res = raw;
+    return true;
+  }
+  auto size = 0zU;
+  auto append = [&buffer, &size](const char* str, size_t n) {
+    n = std::min(n, N - size);
+    std::ranges::copy_n(str, n, buffer.data() + size);
+    size += n;
+  };
+  if (!unescape_json_string(raw, append)) {
+    return r.fail();
+  }
+  res = std::string_view{buffer.data(), size};
+  return true;
+}
+
+template <class T>
+constexpr auto read_json_number(json_reader& r, T& value) -> bool
+{
+  if constexpr (std::is_floating_point_v<T>) {
+    if (r.consume_literal("null")) {
+      value = std::numeric_limits<T>::quiet_NaN();
+      return true;
+    }
+  }
+  r.skip_whitespaces();
+  const auto* head = r.cur;
+  auto token = std::string_view{};
+  if (!r.read_number_token(token)) {
+    return false;
+  }
+  auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(),
+                                   value);
+  if (ec != std::errc{}) {
+    r.cur = head;
+    return r.fail(ec);
+  }
+  if (ptr != token.data() + token.size()) {
+    r.cur = ptr;
+    return r.fail();
+  }
+  return true;
+}
+
+template <class E>
+constexpr auto read_json_enum(json_reader& r, E& value) -> bool
+{
+  if (r.peek() != '"') {
+    auto underlying = std::underlying_type_t<E>{};
+    if (!read_json_number(r, underlying)) {
+      return false;
+    }
+    value = static_cast<E>(underlying);
+    return true;
+  }
+  constexpr auto max_name_size = [] {
+    auto res = 0zU;
+    for (auto name: enum_names<E>()) {
+      res = std::max(res, name.size());
+    }
+    return res;
+  }();
+  const auto* head = r.cur;
+  auto buffer = std::array<char, max_name_size + 1>{};
+  auto name = std::string_view{};
+  if (!read_json_short_string(r, buffer, name)) {
+    return false;
+  }
+  auto res = enum_cast<E>(name);
+  if (!res.has_value()) {
+    r.cur = head;
+    return r.fail();
+  }
+  value = *res;
+  return true;
+}
+
+constexpr auto read_json_string(json_reader& r, std::string& value) -> bool
+{
+  auto raw = std::string_view{};
+  auto has_escape = false;
+  if (!r.read_raw_string(raw, has_escape)) {
+    return false;
+  }
+  if (!has_escape) {
+    value.assign(raw);
+    return true;
+  }
+  value.clear();
+  auto append = [&value](const char* str, size_t n) { value.append(str, n); };
+  return unescape_json_string(raw, append) || r.fail();
+}
+
+template <size_t N>
+constexpr auto read_json_char_array(json_reader& r, char (&value)[N]) -> bool
+{
+  auto raw = std::string_view{};
+  auto has_escape = false;
+  if (!r.read_raw_string(raw, has_escape)) {
+    return false;
+  }
+  auto size = 0zU;
+  auto overflow = false;
+  auto append = [&value, &size, &overflow](const char* str, size_t n) {
+    overflow |= (n > N - size);
+    n = std::min(n, N - size);
+    std::ranges::copy_n(str, n, value + size);
+    size += n;
+  };
+  if (!unescape_json_string(raw, append)) {
+    return r.fail();
+  }
+  if (overflow) {
+    return r.fail(std::errc::value_too_large);
+  }
+  std::ranges::fill(value + size, value + N, '\0');
+  return true;
+}
+
+template <class T>
+constexpr auto read_json_value(json_reader& r, T& value) -> bool;
+
+template <class T>
+using json_member_reader_t = bool (*)(json_reader&, T&);
+
+// Whether value is kept as is when stored to a bit-field of given width.
+template <size_t Width, class T>
+constexpr auto fits_in_bit_field(T value) -> bool
+{
+  if constexpr (std::is_enum_v<T>) {
+    return fits_in_bit_field<Width>(std::to_underlying(value));
+  } else if constexpr (std::is_same_v<T, bool>
+      || Width >= std::numeric_limits<T>::digits + std::is_signed_v<T>) {
+    return true;
+  } else if constexpr (std::is_signed_v<T>) {
+    constexpr auto bound = T{1} << (Width - 1);
+    return -bound <= value && value < bound;
+  } else {
+    return (value >> Width) == 0;
+  }
+}
+
+template <class T, size_t I>
+constexpr auto read_json_member(json_reader& r, T& value) -> bool
+{
+  constexpr auto member = public_flattened_nsdm_v<T>.values[I].member;
+  if constexpr (is_bit_field(member)) {
+    using M = [: type_of(member) :];
+    r.skip_whitespaces();
+    const auto* head = r.cur;
+    auto temp = M{};
+    if (!read_json_value(r, temp)) {
+      return false;
+    }
+    if (!fits_in_bit_field<bit_size_of(member)>(temp)) {
+      r.cur = head;
+      return r.fail(std::errc::result_out_of_range);
+    }
+    value.[: member :] = temp;
+    return true;
+  } else {
+    return read_json_value(r, value.[: member :]);
+  }
+}
+
+// Jump table indexed by the member index from json_key_table_v<T>.
+template <class T>
+consteval auto make_json_member_readers()
+{
+  constexpr auto N = public_flattened_nsdm_v<T>.size();
+  if constexpr (N == 0) {
+    return std::array<json_member_reader_t<T>, 0>{};
+  } else {
+    return REFLECT_CPP26_EXPAND_I(N).map([](auto I) {
+      return static_cast<json_member_reader_t<T>>(&read_json_member<T, I>);
+    });
+  }
+}
+
+template <class T>
+constexpr auto json_member_readers_v = make_json_member_readers<T>();
+
+template <class T>
+constexpr auto read_json_object(json_reader& r, T& value) -> bool
+{
+  constexpr const auto& key_table = json_key_table_v<T>;
+  if (!r.expect('{')) {
+    return false;
+  }
+  if (r.consume('}')) {
+    return true;
+  }
+  auto buffer = std::array<char, key_table.max_key_size + 1>{};
+  do {
+    auto key = std::string_view{};
+    if (!read_json_short_string(r, buffer, key) || !r.expect(':')) {
+      return false;
+    }
+    auto index = key_table.find(key);
+    auto ok = (index == npos) ? r.skip_value()
+      : json_member_readers_v<T>[index](r, value);
+    if (!ok) {
+      return false;
+    }
+  } while (r.consume(','));
+  return r.expect('}');
+}
+
+template <class T>
+constexpr auto read_json_value(json_reader& r, T& value) -> bool
+{
+  if constexpr (std::is_same_v<T, bool>) {
+    if (r.consume_literal("true")) {
+      value = true;
+      return true;
+    }
+    if (r.consume_literal("false")) {
+      value = false;
+      return true;
+    }
+    return r.fail();
+  } else if constexpr (std::is_same_v<T, char>) {
+    r.skip_whitespaces();
+    const auto* head = r.cur;
+    auto buffer = std::array<char, 2>{};
+    auto str = std::string_view{};
+    if (!read_json_short_string(r, buffer, str)) {
+      return false;
+    }
+    if (str.size() != 1) {
+      r.cur = head;
+      return r.fail();
+    }
+    value = str[0];
+    return true;
+  } else if constexpr (integer_type<T> || std::is_floating_point_v<T>) {
+    return read_json_number(r, value);
+  } else if constexpr (std::is_enum_v<T>) {
+    return read_json_enum(r, value);
+  } else if constexpr (std::is_same_v<T, std::string>) {
+    return read_json_string(r, value);
+  } else if constexpr (is_json_char_array_target_v<T>) {
+    return read_json_char_array(r, value);
+  } else if constexpr (template_instance_of<T, std::optional>) {
+    if (r.consume_literal("null")) {
+      value.reset();
+      return true;
+    }
+    return read_json_value(r, value.emplace());
+  } else if constexpr (std::is_bounded_array_v<T>) {
+    if (!r.expect('[')) {
+      return false;
+    }
+    for (auto i = 0zU; i < std::extent_v<T>; i++) {
+      if ((i != 0 && !r.expect(',')) || !read_json_value(r, value[i])) {
+        return false;
+      }
+    }
+    return r.expect(']');
+  } else if constexpr (is_tuple_like_v<T>) {
+    if (!r.expect('[')) {
+      return false;
+    }
+    auto res = true;
+    REFLECT_CPP26_EXPAND_I(std::tuple_size_v<T>).for_each(
+      [&r, &value, &res](auto I) {
+        if constexpr (I != 0) {
+          res = r.expect(',');
+        }
+        res = res && read_json_value(r, tuple_get<I>(value));
+        return /* continues if */ res;
+      });
+    return res && r.expect(']');
+  } else if constexpr (json_emplace_back_container<T>) {
+    if (!r.expect('[')) {
+      return false;
+    }
+    value.clear();
+    if (r.consume(']')) {
+      return true;
+    }
+    do {
+      if (!read_json_value(r, value.emplace_back())) {
+        return false;
+      }
+    } while (r.consume(','));
+    return r.expect(']');
+  } else if constexpr (flattenable_class<T>) {
+    return read_json_object(r, value);
+  } else {
+    static_assert(false, "Invalid type.");
+  }
+}
+} // namespace impl
+
+/**
+ * Parses a JSON value from [first, last) into value in a single pass.
+ * Similar to std::from_chars, ptr of the result points to the first
+ * character after the parsed value on success, or where the failure occurs
+ * otherwise, with ec set to:
+ *   - std::errc::invalid_argument on syntax error or type mismatch;
+ *   - std::errc::result_out_of_range if a number does not fit, including
+ *     the width of a bit-field member;
+ *   - std::errc::value_too_large if a string does not fit in a char array.
+ * value may be partially modified on failure.
+ */
+template <json_deserializable T>
+constexpr auto from_json(const char* first, const char* last, T& value)
+  -> std::from_chars_result
+{
+  auto reader = impl::json_reader{.cur = first, .end = last};
+  impl::read_json_value(reader, value);
+  return {reader.cur, reader.ec};
+}
+
+/**
+ * Parses the whole json string (surrounding whitespaces allowed) into
+ * a value-initialized T. Returns std::nullopt on failure.
+ */
+template <json_deserializable T>
+  requires (std::is_default_constructible_v<T>)
+constexpr auto from_json(std::string_view json) -> std::optional<T>
+{
+  auto res = std::optional<T>{std::in_place};
+  auto reader = impl::json_reader{
+    .cur = json.data(), .end = json.data() + json.size()};
+  if (!impl::read_json_value(reader, *res) || reader.peek() != -1) {
+    return std::nullopt;
+  }
+  return res;
+}
+} // namespace reflect_cpp26
+
+#endif // REFLECT_CPP26_TYPE_OPERATIONS_FROM_JSON_HPP
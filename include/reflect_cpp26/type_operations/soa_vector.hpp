@@ -0,0 +1,365 @@
+#ifndef REFLECT_CPP26_TYPE_OPERATIONS_SOA_VECTOR_HPP
+#define REFLECT_CPP26_TYPE_OPERATIONS_SOA_VECTOR_HPP
+
+#include <reflect_cpp26/type_operations/define_aggregate.hpp>
+#include <reflect_cpp26/type_traits/class_types/flattenable.hpp>
+#include <reflect_cpp26/type_traits/class_types/member_traits.hpp>
+#include <reflect_cpp26/utils/meta_utility.hpp>
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <utility>
+
+namespace reflect_cpp26 {
+namespace impl {
+template <class T>
+consteval bool is_soa_element();
+} // namespace impl
+
+template <class T>
+constexpr auto is_soa_element_v = impl::is_soa_element<T>();
+
+/**
+ * Whether T can be element type of soa_vector<T>, i.e. T is a default
+ * constructible flattenable class (see flattenable_class) whose members are
+ * non-const, non-reference, default constructible and copy assignable.
+ * Member names of T shall be unique.
+ */
+template <class T>
+concept soa_element = is_soa_element_v<T>;
+
+namespace impl {
+template <class T>
+consteval bool is_soa_element()
+{
+  if constexpr (!flattenable_class<T> || std::is_const_v<T>
+                || !std::is_default_constructible_v<T>) {
+    return false;
+  } else {
+    auto res = true;
+    public_flattened_nsdm_v<T>.for_each([&res](auto spec) {
+      using M = [: type_of(spec.value.member) :];
+      res &= !std::is_const_v<M> && !std::is_reference_v<M>
+        && std::is_default_constructible_v<M> && std::is_copy_assignable_v<M>;
+      return res;
+    });
+    return res;
+  }
+}
+
+template <class M>
+using soa_column_t = std::unique_ptr<M[]>;
+
+// Column of each member with the same name: std::unique_ptr<M[]>
+struct soa_column_transform {
+  static consteval auto operator()(std::meta::info member) -> std::meta::info
+  {
+    auto type = reflect_cpp26::substitute(
+      ^^soa_column_t, remove_cv(type_of(member)));
+    return data_member_spec(type, {.name = identifier_of(member)});
+  }
+};
+
+// Reference to each member with the same name: M& or const M&
+template <bool IsConst>
+struct soa_reference_transform {
+  static consteval auto operator()(std::meta::info member) -> std::meta::info
+  {
+    auto type = remove_cv(type_of(member));
+    if constexpr (IsConst) {
+      type = add_const(type);
+    }
+    return data_member_spec(
+      add_lvalue_reference(type), {.name = identifier_of(member)});
+  }
+};
+
+// Index of the member pointed by MemPtr in public_flattened_nsdm_v<T>.
+template <class T, auto MemPtr>
+consteval auto soa_column_index() -> size_t
+{
+  auto member = reflect_pointer_to_member(MemPtr);
+  auto specs = public_flattened_nsdm_v<T>.to_vector();
+  auto res = npos;
+  for (auto i = 0zU, n = specs.size(); i < n && res == npos; i++) {
+    if (specs[i].member == member) {
+      res = i;
+    }
+  }
+  if (res == npos) {
+    compile_error("MemPtr is not a public member of T.");
+  }
+  return res;
+}
+} // namespace impl
+
+/**
+ * Storage of soa_vector<T>: aggregate with one column per member in
+ * public_flattened_nsdm_v<T>, whose name is the same as the member.
+ */
+template <soa_element T>
+using soa_columns_of =
+  aggregate_by_flattened_memberwise_t<impl::soa_column_transform, T>;
+
+/**
+ * Proxy references of soa_vector<T> elements: aggregates with one reference
+ * per member in public_flattened_nsdm_v<T>, whose name is the same as the
+ * member, e.g. v[i].x = 42 modifies column x only.
+ */
+template <soa_element T>
+using soa_reference_of = aggregate_by_flattened_memberwise_t<
+  impl::soa_reference_transform<false>, T>;
+
+template <soa_element T>
+using soa_const_reference_of = aggregate_by_flattened_memberwise_t<
+  impl::soa_reference_transform<true>, T>;
+
+/**
+ * Struct-of-arrays container of T, which keeps one contiguous column per
+ * member in public_flattened_nsdm_v<T>. All columns share the same size and
+ * capacity. Elements are scattered into columns on insertion and gathered
+ * on get(). Each column is accessible as std::span with column<&T::x>().
+ */
+template <soa_element T>
+class soa_vector {
+public:
+  using value_type = T;
+  using columns_type = soa_columns_of<T>;
+  using reference = soa_reference_of<T>;
+  using const_reference = soa_const_reference_of<T>;
+
+  static constexpr auto column_count = public_flattened_nsdm_v<T>.size();
+
+  soa_vector() = default;
+
+  soa_vector(const soa_vector& rhs)
+  {
+    reserve(rhs.size_);
+    for_each_column_pair(columns_, rhs.columns_,
+      [n = rhs.size_](auto& dest, const auto& src) {
+        std::ranges::copy_n(src.get(), n, dest.get());
+      });
+    size_ = rhs.size_;
+  }
+
+  soa_vector(soa_vector&& rhs) noexcept
+    : columns_(std::move(rhs.columns_))
+    , size_(std::exchange(rhs.size_, 0))
+    , capacity_(std::exchange(rhs.capacity_, 0)) {}
+
+  auto operator=(const soa_vector& rhs) -> soa_vector&
+  {
+    if (this != &rhs) {
+      *this = soa_vector{rhs};
+    }
+    return *this;
+  }
+
+  auto operator=(soa_vector&& rhs) noexcept -> soa_vector&
+  {
+    columns_ = std::move(rhs.columns_);
+    size_ = std::exchange(rhs.size_, 0);
+    capacity_ = std::exchange(rhs.capacity_, 0);
+    return *this;
+  }
+
+  auto size() const -> size_t {
+    return size_;
+  }
+
+  auto capacity() const -> size_t {
+    return capacity_;
+  }
+
+  auto empty() const -> bool {
+    return size_ == 0;
+  }
+
+  void reserve(size_t n)
+  {
+    if (n > capacity_) {
+      reallocate(n);
+    }
+  }
+
+  void clear()
+  {
+    reset_range(0, size_);
+    size_ = 0;
+  }
+
+  // New elements are value-initialized memberwise.
+  void resize(size_t n)
+  {
+    reserve(n);
+    reset_range(std::min(n, size_), std::max(n, size_));
+    size_ = n;
+  }
+
+  // Scatters members of value into the columns.
+  // Strong exception guarantee: *this is unchanged if anything throws.
+  void push_back(const T& value)
+  {
+    if (size_ == capacity_) {
+      auto new_capacity = std::max(capacity_ * 2, min_capacity);
+      auto fresh = allocate_columns(new_capacity);
+      // The new element goes first so that no element is transferred
+      // (possibly moved) before copying value which may throw.
+      assign(fresh, size_, value);
+      transfer_elements(fresh);
+      columns_ = std::move(fresh);
+      capacity_ = new_capacity;
+    } else {
+      assign(columns_, size_, value);
+    }
+    size_ += 1;
+  }
+
+  // Precondition: !empty()
+  void pop_back()
+  {
+    reset_range(size_ - 1, size_);
+    size_ -= 1;
+  }
+
+  // Gathers members of the index-th element. Precondition: index < size()
+  auto get(size_t index) const -> T
+  {
+    auto res = T{};
+    for_each_member([this, &res, index](auto I, auto spec) {
+      res.[: spec.value.member :] = columns_.[: column_member<I> :][index];
+    });
+    return res;
+  }
+
+  // Scatters members of value. Precondition: index < size()
+  void set(size_t index, const T& value) {
+    assign(columns_, index, value);
+  }
+
+  // Precondition: index < size()
+  auto operator[](size_t index) -> reference
+  {
+    return [this, index]<size_t... Is>(std::index_sequence<Is...>) {
+      return reference{columns_.[: column_member<Is> :][index]...};
+    }(std::make_index_sequence<column_count>{});
+  }
+
+  // Precondition: index < size()
+  auto operator[](size_t index) const -> const_reference
+  {
+    return [this, index]<size_t... Is>(std::index_sequence<Is...>) {
+      return const_reference{columns_.[: column_member<Is> :][index]...};
+    }(std::make_index_sequence<column_count>{});
+  }
+
+  /**
+   * Column of member pointed by MemPtr as a contiguous span of size(),
+   * e.g. column<&T::x>(), which is suitable for vectorized kernels.
+   */
+  template <auto MemPtr>
+    requires (is_non_null_member_object_pointer_value_v<MemPtr>)
+  auto column()
+  {
+    constexpr auto index = impl::soa_column_index<T, MemPtr>();
+    return std::span{columns_.[: column_member<index> :].get(), size_};
+  }
+
+  template <auto MemPtr>
+    requires (is_non_null_member_object_pointer_value_v<MemPtr>)
+  auto column() const
+  {
+    constexpr auto index = impl::soa_column_index<T, MemPtr>();
+    const auto* data = columns_.[: column_member<index> :].get();
+    return std::span{data, size_};
+  }
+
+private:
+  static constexpr size_t min_capacity = 8;
+
+  template <size_t I>
+  static constexpr auto column_member =
+    public_flattened_nsdm_v<columns_type>.values[I].member;
+
+  // Invokes func(constant<I>, constant<spec>) for each member of T.
+  template <class Func>
+  static void for_each_member(Func&& func)
+  {
+    public_flattened_nsdm_v<T>.for_each([&func](auto I, auto spec) {
+      func(I, spec);
+    });
+  }
+
+  static void assign(columns_type& columns, size_t index, const T& value)
+  {
+    for_each_member([&columns, &value, index](auto I, auto spec) {
+      columns.[: column_member<I> :][index] = value.[: spec.value.member :];
+    });
+  }
+
+  template <class Func>
+  static void for_each_column_pair(
+    columns_type& dest, const columns_type& src, Func&& func)
+  {
+    REFLECT_CPP26_EXPAND_I(column_count).for_each([&](auto I) {
+      func(dest.[: column_member<I> :], src.[: column_member<I> :]);
+    });
+  }
+
+  // Elements are not transferred until all the columns are allocated.
+  static auto allocate_columns(size_t capacity) -> columns_type
+  {
+    auto res = columns_type{};
+    REFLECT_CPP26_EXPAND_I(column_count).for_each([&](auto I) {
+      auto& column = res.[: column_member<I> :];
+      using M = typename std::remove_cvref_t<decltype(column)>::element_type;
+      column = std::make_unique_for_overwrite<M[]>(capacity);
+    });
+    return res;
+  }
+
+  // Columns whose move assignment may throw are copied first, and then the
+  // others are moved, so that *this is left untouched if anything throws.
+  void transfer_elements(columns_type& dest)
+  {
+    for_each_column_pair(dest, columns_, [n = size_](auto& to, auto& from) {
+      using M = typename std::remove_cvref_t<decltype(from)>::element_type;
+      if constexpr (!std::is_nothrow_move_assignable_v<M>) {
+        std::ranges::copy_n(from.get(), n, to.get());
+      }
+    });
+    for_each_column_pair(dest, columns_, [n = size_](auto& to, auto& from) {
+      using M = typename std::remove_cvref_t<decltype(from)>::element_type;
+      if constexpr (std::is_nothrow_move_assignable_v<M>) {
+        std::ranges::move(from.get(), from.get() + n, to.get());
+      }
+    });
+  }
+
+  // Strong exception guarantee.
+  void reallocate(size_t new_capacity)
+  {
+    auto fresh = allocate_columns(new_capacity);
+    transfer_elements(fresh);
+    columns_ = std::move(fresh);
+    capacity_ = new_capacity;
+  }
+
+  // Value-initializes elements in [first, last) of each column, which also
+  // releases resources held by elements removed.
+  void reset_range(size_t first, size_t last)
+  {
+    REFLECT_CPP26_EXPAND_I(column_count).for_each([&](auto I) {
+      auto* data = columns_.[: column_member<I> :].get();
+      using M = std::remove_pointer_t<decltype(data)>;
+      std::ranges::fill(data + first, data + last, M{});
+    });
+  }
+
+  columns_type columns_;
+  size_t size_ = 0;
+  size_t capacity_ = 0;
+};
+} // namespace reflect_cpp26
+
+#endif // REFLECT_CPP26_TYPE_OPERATIONS_SOA_VECTOR_HPP
@@ -0,0 +1,276 @@
+#ifndef REFLECT_CPP26_TYPE_OPERATIONS_TO_JSON_HPP
+#define REFLECT_CPP26_TYPE_OPERATIONS_TO_JSON_HPP
+
+#include <reflect_cpp26/annotations/properties.hpp>
+#include <reflect_cpp26/enum/enum_names.hpp>
+#include <reflect_cpp26/type_traits/arithmetic_types.hpp>
+#include <reflect_cpp26/type_traits/class_types/flattenable.hpp>
+#include <reflect_cpp26/type_traits/template_instance.hpp>
+#include <reflect_cpp26/type_traits/tuple_like_types.hpp>
+#include <reflect_cpp26/type_traits/type_comparison.hpp>
+#include <reflect_cpp26/utils/define_static_values.hpp>
+#include <reflect_cpp26/utils/meta_tuple.hpp>
+#include <reflect_cpp26/utils/to_string_utils.hpp>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <string>
+#include <utility>
+
+namespace reflect_cpp26 {
+namespace impl {
+template <class T>
+consteval bool is_json_serializable();
+} // namespace impl
+
+template <class T>
+constexpr auto is_json_serializable_v =
+  impl::is_json_serializable<std::remove_cv_t<T>>();
+
+/**
+ * Whether T can be serialized with to_json() and append_json(), i.e. T is
+ * one of the types below (checked in order):
+ *   (1) std::nullptr_t or std::nullopt_t, serialized as null;
+ *   (2) bool;
+ *   (3) char, serialized as a string of length 1;
+ *   (4) integer types (see integer_type) and floating-point types, where
+ *       NaN and infinity are serialized as null;
+ *   (5) enum types, serialized as enum name string, or underlying value
+ *       if the value has no name;
+ *   (6) char arrays (terminated by the first '\0' if any) and types
+ *       convertible to std::string_view, serialized as escaped string;
+ *   (7) std::optional<U> where U is serializable, serialized as null or U;
+ *   (8) input ranges or tuple-like types whose elements are serializable,
+ *       serialized as array;
+ *   (9) flattenable class types (see flattenable_class) whose members are
+ *       serializable, serialized as object of members in
+ *       public_flattened_nsdm_v<T>. Key of each member is its identifier,
+ *       or rename_t property annotated to the member if any.
+ */
+template <class T>
+concept json_serializable = is_json_serializable_v<T>;
+
+namespace impl {
+template <class T>
+constexpr auto is_json_string_like_v =
+  std::is_convertible_v<const T&, std::string_view>;
+
+template <class T>
+constexpr auto is_json_char_array_v =
+  std::is_array_v<T> && std::is_same_v<std::remove_extent_t<T>, char>;
+
+template <class T>
+consteval bool is_json_serializable()
+{
+  if constexpr (same_as_one_of<T, std::nullptr_t, std::nullopt_t, bool, char>
+      || integer_type<T> || std::is_floating_point_v<T>
+      || std::is_enum_v<T>
+      || is_json_char_array_v<T> || is_json_string_like_v<T>) {
+    return true;
+  } else if constexpr (template_instance_of<T, std::optional>) {
+    return is_json_serializable_v<typename T::value_type>;
+  } else if constexpr (std::ranges::input_range<T>) {
+    return is_json_serializable_v<std::ranges::range_value_t<T>>;
+  } else if constexpr (is_tuple_like_v<T>) {
+    auto res = true;
+    REFLECT_CPP26_EXPAND_I(std::tuple_size_v<T>).for_each([&res](auto I) {
+      return res &= is_json_serializable_v<std::tuple_element_t<I, T>>;
+    });
+    return res;
+  } else if constexpr (flattenable_class<T>) {
+    auto res = true;
+    public_flattened_nsdm_v<T>.for_each([&res](auto spec) {
+      using M = [: type_of(spec.value.member) :];
+      return res &= is_json_serializable_v<M>;
+    });
+    return res;
+  } else {
+    return false;
+  }
+}
+
+// Escapes str as content of JSON string, excluding quotation marks.
+constexpr void append_json_escaped(std::string& out, std::string_view str)
+{
+  constexpr auto hex_digits = std::string_view{"0123456789abcdef"};
+  auto run_head = 0zU;
+  for (auto i = 0zU, n = str.size(); i < n; i++) {
+    auto c = static_cast<unsigned char>(str[i]);
+    if (c >= 0x20 && c != '"' && c != '\\') {
+      continue;
+    }
+    out.append(str.data() + run_head, i - run_head);
+    run_head = i + 1;
+    out += '\\';
+    switch (c) {
+      case '"':  out += '"'; break;
+      case '\\': out += '\\'; break;
+      case '\b': out += 'b'; break;
+      case '\f': out += 'f'; break;
+      case '\n': out += 'n'; break;
+      case '\r': out += 'r'; break;
+      case '\t': out += 't'; break;
+      default:
+        out += "u00";
+        out += hex_digits[c >> 4];
+        out += hex_digits[c & 15];
+        break;
+    }
+  }
+  out.append(str.data() + run_head, str.size() - run_head);
+}
+
+constexpr void append_json_string(std::string& out, std::string_view str)
+{
+  out += '"';
+  append_json_escaped(out, str);
+  out += '"';
+}
+
+template <class T>
+constexpr void append_json_number(std::string& out, T value)
+{
+  if constexpr (std::is_floating_point_v<T>) {
+    // Not representable in JSON. Note that NaN fails the comparison.
+    if (!(std::abs(value) <= std::numeric_limits<T>::max())) {
+      out += "null";
+      return;
+    }
+    // Enough for the shortest round-trip representation
+    char buffer[64];
+    auto res = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, res.ptr);
+  } else {
+    char buffer[max_decimal_digits(sizeof(T))];
+    auto res = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, res.ptr);
+  }
+}
+
+// '{' or ',' followed by "key": of the I-th member of T.
+template <class T, size_t I>
+consteval auto make_json_member_prefix() -> std::string
+{
+  constexpr auto member = public_flattened_nsdm_v<T>.values[I].member;
+  constexpr auto rename = annotations::impl::find_annotation_of_type(
+    ^^annotations::rename_t, member);
+
+  auto res = std::string{I == 0 ? "{\"" : ",\""};
+  if constexpr (std::meta::info{} == rename) {
+    append_json_escaped(res, identifier_of(member));
+  } else {
+    append_json_escaped(res, extract<annotations::rename_t>(rename).value);
+  }
+  res += "\":";
+  return res;
+}
+
+template <class T, size_t I>
+constexpr auto json_member_prefix_v =
+  reflect_cpp26::define_static_string(make_json_member_prefix<T, I>());
+
+template <class T>
+constexpr void append_json_value(std::string& out, const T& value);
+
+template <class T>
+constexpr void append_json_object(std::string& out, const T& value)
+{
+  constexpr auto members = public_flattened_nsdm_v<T>;
+  if constexpr (members.size() == 0) {
+    out += "{}";
+  } else {
+    members.for_each([&out, &value](auto I, auto spec) {
+      out += std::string_view{json_member_prefix_v<T, I>};
+      append_json_value(out, value.[: spec.value.member :]);
+    });
+    out += '}';
+  }
+}
+
+template <class T>
+constexpr void append_json_value(std::string& out, const T& value)
+{
+  if constexpr (same_as_one_of<T, std::nullptr_t, std::nullopt_t>) {
+    out += "null";
+  } else if constexpr (std::is_same_v<T, bool>) {
+    out += value ? "true" : "false";
+  } else if constexpr (std::is_same_v<T, char>) {
+    append_json_string(out, std::string_view{&value, 1});
+  } else if constexpr (integer_type<T> || std::is_floating_point_v<T>) {
+    append_json_number(out, value);
+  } else if constexpr (std::is_enum_v<T>) {
+    auto name = enum_name(value);
+    if (name.empty()) {
+      append_json_number(out, std::to_underlying(value));
+    } else {
+      // Enum names are identifiers which require no escaping
+      out += '"';
+      out += name;
+      out += '"';
+    }
+  } else if constexpr (is_json_char_array_v<T>) {
+    auto tail = std::ranges::find(value, '\0');
+    append_json_string(out, std::string_view{std::begin(value), tail});
+  } else if constexpr (is_json_string_like_v<T>) {
+    append_json_string(out, value);
+  } else if constexpr (template_instance_of<T, std::optional>) {
+    if (value.has_value()) {
+      append_json_value(out, *value);
+    } else {
+      out += "null";
+    }
+  } else if constexpr (std::ranges::input_range<T>) {
+    out += '[';
+    auto index = 0zU;
+    for (const auto& cur: value) {
+      if (index++ != 0) {
+        out += ',';
+      }
+      append_json_value(out, cur);
+    }
+    out += ']';
+  } else if constexpr (is_tuple_like_v<T>) {
+    out += '[';
+    REFLECT_CPP26_EXPAND_I(std::tuple_size_v<T>).for_each(
+      [&out, &value](auto I) {
+        if constexpr (I != 0) {
+          out += ',';
+        }
+        append_json_value(out, tuple_get<I>(value));
+      });
+    out += ']';
+  } else if constexpr (flattenable_class<T>) {
+    append_json_object(out, value);
+  } else {
+    static_assert(false, "Invalid type.");
+  }
+}
+} // namespace impl
+
+/**
+ * Appends compact JSON representation of value to out (see
+ * json_serializable for details). Keys of class members are precomputed as
+ * static strings, thus no allocation is made except growth of out, which
+ * can be amortized by reusing the same buffer (e.g. with out.clear()).
+ */
+template <json_serializable T>
+constexpr void append_json(std::string& out, const T& value) {
+  impl::append_json_value(out, value);
+}
+
+/**
+ * Gets compact JSON representation of value (see json_serializable).
+ */
+template <json_serializable T>
+constexpr auto to_json(const T& value) -> std::string
+{
+  auto res = std::string{};
+  impl::append_json_value(res, value);
+  return res;
+}
+} // namespace reflect_cpp26
+
+#endif // REFLECT_CPP26_TYPE_OPERATIONS_TO_JSON_HPP
@@ -2,7 +2,9 @@
 #define REFLECT_CPP26_TYPE_OPERATIONS_TO_STRING_HPP
 
 #include <reflect_cpp26/enum/enum_names.hpp>
+#include <reflect_cpp26/enum/enum_to_chars.hpp>
 #include <reflect_cpp26/enum/enum_type_name.hpp>
+#include <reflect_cpp26/type_traits/arithmetic_types.hpp>
 #include <reflect_cpp26/type_traits/tuple_like_types.hpp>
 #include <reflect_cpp26/utils/meta_tuple.hpp>
 #include <reflect_cpp26/utils/to_string.hpp>
@@ -59,9 +61,20 @@ constexpr auto generic_enum_to_string(T input) -> std::string
   if (!sv.empty()) {
     return std::string{sv};
   }
-  auto res = std::string{"("} + enum_type_name<T>() + ')';
-  res += to_string(std::to_underlying(input));
-  return res;
+  if constexpr (is_char_type_v<std::underlying_type_t<T>>) {
+    // Character is kept as is, unlike enum_to_chars()
+    auto res = std::string{"("} + enum_type_name<T>() + ')';
+    res += to_string(std::to_underlying(input));
+    return res;
+  } else {
+    // Name lookup above is not repeated
+    auto res = std::string{};
+    res.resize_and_overwrite(enum_to_chars_max_size<T>(),
+      [input](char* buffer, size_t) {
+        return enum_to_chars_fallback_unchecked(buffer, input) - buffer;
+      });
+    return res;
+  }
 }
 
 template <class ToStringFn, class T>
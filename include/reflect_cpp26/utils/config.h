@@ -36,9 +36,16 @@ namespace reflect_cpp26 {
     REFLECT_CPP26_ERROR_IF_CONSTEVAL(msg);  \
     __builtin_unreachable();                \
   } while (false)
+#define REFLECT_CPP26_PREFETCH(addr)  \
+  do {                                \
+    if !consteval {                   \
+      __builtin_prefetch(addr);       \
+    }                                 \
+  } while (false)
 #else
 #define REFLECT_CPP26_ERROR_IF_CONSTEVAL(msg) // No-op
 #define REFLECT_CPP26_UNREACHABLE(msg) __builtin_unreachable()
+#define REFLECT_CPP26_PREFETCH(addr) __builtin_prefetch(addr)
 #endif
 
 #endif // REFLECT_CPP26_UTILS_CONFIG_H
@@ -0,0 +1,107 @@
+#ifndef REFLECT_CPP26_UTILS_SIMD_FIND_HPP
+#define REFLECT_CPP26_UTILS_SIMD_FIND_HPP
+
+#include <reflect_cpp26/utils/constant.hpp>
+#include <bit>
+#include <cstdint>
+#include <span>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace reflect_cpp26 {
+namespace impl {
+// Returns the first index i in [0, n) with first[i] == key, or n if not found.
+// Keys are compared vector by vector; the remaining tail is left to caller.
+inline auto find_u64_vectorized(const uint64_t* first, size_t n, uint64_t key)
+  -> size_t
+{
+  auto i = 0zU;
+#if defined(__AVX2__)
+  auto k = _mm256_set1_epi64x(static_cast<int64_t>(key));
+  for (; i + 8 <= n; i += 8) {
+    auto v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i));
+    auto v1 = _mm256_loadu_si256(
+      reinterpret_cast<const __m256i*>(first + i + 4));
+    auto m0 = _mm256_movemask_pd(
+      _mm256_castsi256_pd(_mm256_cmpeq_epi64(v0, k)));
+    auto m1 = _mm256_movemask_pd(
+      _mm256_castsi256_pd(_mm256_cmpeq_epi64(v1, k)));
+    auto mask = static_cast<unsigned>(m0) | (static_cast<unsigned>(m1) << 4);
+    if (mask != 0) {
+      return i + std::countr_zero(mask);
+    }
+  }
+  for (; i + 4 <= n; i += 4) {
+    auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i));
+    auto mask = static_cast<unsigned>(_mm256_movemask_pd(
+      _mm256_castsi256_pd(_mm256_cmpeq_epi64(v, k))));
+    if (mask != 0) {
+      return i + std::countr_zero(mask);
+    }
+  }
+#elif defined(__SSE2__)
+  // SSE2 has no 64-bit equality: both 32-bit halves shall be equal.
+  auto k = _mm_set1_epi64x(static_cast<int64_t>(key));
+  for (; i + 4 <= n; i += 4) {
+    auto v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+    auto v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i + 2));
+    auto e0 = _mm_cmpeq_epi32(v0, k);
+    auto e1 = _mm_cmpeq_epi32(v1, k);
+    e0 = _mm_and_si128(e0, _mm_shuffle_epi32(e0, _MM_SHUFFLE(2, 3, 0, 1)));
+    e1 = _mm_and_si128(e1, _mm_shuffle_epi32(e1, _MM_SHUFFLE(2, 3, 0, 1)));
+    auto mask = static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(e0)))
+      | (static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(e1))) << 2);
+    if (mask != 0) {
+      return i + std::countr_zero(mask);
+    }
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  auto k = vdupq_n_u64(key);
+  for (; i + 4 <= n; i += 4) {
+    auto e0 = vceqq_u64(vld1q_u64(first + i), k);
+    auto e1 = vceqq_u64(vld1q_u64(first + i + 2), k);
+    // Narrows each 64-bit lane to 16 bits: lane j of result <-> key i + j
+    auto e = vcombine_u32(vmovn_u64(e0), vmovn_u64(e1));
+    auto bits = vget_lane_u64(vreinterpret_u64_u16(vmovn_u32(e)), 0);
+    if (bits != 0) {
+      return i + std::countr_zero(bits) / 16;
+    }
+  }
+#endif
+  for (; i < n; i++) {
+    if (first[i] == key) {
+      return i;
+    }
+  }
+  return n;
+}
+} // namespace impl
+
+/**
+ * Returns the index of the first occurrence of key in keys,
+ * or npos if not found.
+ * Multiple keys are compared per instruction in run-time if SIMD is available
+ * (AVX2, SSE2 or AArch64 NEON). Falls back to scalar loop in compile-time.
+ */
+constexpr auto find_u64(std::span<const uint64_t> keys, uint64_t key)
+  -> size_t
+{
+  auto n = keys.size();
+  if !consteval {
+    auto res = impl::find_u64_vectorized(keys.data(), n, key);
+    return (res == n) ? npos : res;
+  }
+  for (auto i = 0zU; i < n; i++) {
+    if (keys[i] == key) {
+      return i;
+    }
+  }
+  return npos;
+}
+} // namespace reflect_cpp26
+
+#endif // REFLECT_CPP26_UTILS_SIMD_FIND_HPP
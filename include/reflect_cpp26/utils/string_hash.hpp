@@ -1,9 +1,20 @@
 #ifndef REFLECT_CPP26_UTILS_STRING_HASH_HPP
 #define REFLECT_CPP26_UTILS_STRING_HASH_HPP
 
+#include <reflect_cpp26/utils/ctype.hpp>
+#include <array>
+#include <bit>
+#include <concepts>
 #include <cstdint>
+#include <cstring>
 #include <string_view>
 
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
 namespace reflect_cpp26 {
 constexpr unsigned bkdr_hash_default_p = 131u;
 
@@ -38,6 +49,237 @@ constexpr uint64_t bkdr_hash64(
 {
   return bkdr_hash64(str.data(), str.data() + str.size(), p);
 }
+
+namespace impl {
+// Loads 8 bytes as little-endian integer, regardless of native endianness
+// so that results in compile-time and run-time are always identical.
+constexpr auto load_u64_le(const char* p) -> uint64_t
+{
+  if consteval {
+    auto res = uint64_t{0};
+    for (auto i = 0; i < 8; i++) {
+      res |= static_cast<uint64_t>(static_cast<uint8_t>(p[i])) << (i * 8);
+    }
+    return res;
+  } else {
+    auto res = uint64_t{0};
+    std::memcpy(&res, p, sizeof(uint64_t));
+    if constexpr (std::endian::native == std::endian::big) {
+      res = std::byteswap(res);
+    }
+    return res;
+  }
+}
+
+// Loads n < 8 bytes as little-endian integer with zero padding.
+constexpr auto load_partial_u64_le(const char* p, size_t n) -> uint64_t
+{
+  auto res = uint64_t{0};
+  for (auto i = 0zU; i < n; i++) {
+    res |= static_cast<uint64_t>(static_cast<uint8_t>(p[i])) << (i * 8);
+  }
+  return res;
+}
+
+// Converts ASCII upper-case letters in each byte of v to lower-case.
+// Non-ASCII bytes (>= 0x80) are kept as-is.
+constexpr auto ascii_tolower_u64(uint64_t v) -> uint64_t
+{
+  constexpr auto ones = 0x0101'0101'0101'0101llu;
+  constexpr auto high_bits = ones * 0x80u;
+  auto heptets = v & ~high_bits;
+  auto ge_upper_a = heptets + ones * (0x80u - 'A');
+  auto gt_upper_z = heptets + ones * (0x80u - 'Z' - 1);
+  auto is_upper = (ge_upper_a ^ gt_upper_z) & ~v & high_bits;
+  return v | (is_upper >> 2); // 0x80 >> 2 == 'a' - 'A'
+}
+
+template <bool ICase>
+constexpr auto maybe_tolower_u64(uint64_t v) -> uint64_t {
+  return ICase ? ascii_tolower_u64(v) : v;
+}
+
+constexpr uint32_t crc32c_poly_reversed = 0x82f6'3b78u;
+
+consteval auto make_crc32c_table() -> std::array<uint32_t, 256>
+{
+  auto res = std::array<uint32_t, 256>{};
+  for (auto i = 0u; i < 256u; i++) {
+    auto cur = i;
+    for (auto k = 0; k < 8; k++) {
+      cur = (cur >> 1) ^ ((cur & 1u) ? crc32c_poly_reversed : 0u);
+    }
+    res[i] = cur;
+  }
+  return res;
+}
+
+constexpr auto crc32c_table = make_crc32c_table();
+
+// CRC32C of the 8 bytes of v in little-endian order.
+constexpr auto crc32c_u64(uint32_t crc, uint64_t v) -> uint32_t
+{
+  if !consteval {
+#if defined(__SSE4_2__) && defined(__x86_64__)
+    return static_cast<uint32_t>(_mm_crc32_u64(crc, v));
+#elif defined(__ARM_FEATURE_CRC32)
+    return __crc32cd(crc, v);
+#endif
+  }
+  for (auto i = 0; i < 8; i++, v >>= 8) {
+    crc = crc32c_table[(crc ^ v) & 0xffu] ^ (crc >> 8);
+  }
+  return crc;
+}
+} // namespace impl
+
+/**
+ * String hash policies. Every policy type H satisfies:
+ *   (1) H::operator()(str, seed) returns the 64-bit hash value of str
+ *       which is consistent in compile-time and run-time;
+ *   (2) H::is_seeded indicates whether different seeds lead to
+ *       different collision patterns. Seed is ignored if it's false.
+ */
+template <class H>
+concept string_hash_policy = requires (std::string_view str, uint64_t seed) {
+  { H::operator()(str, seed) } -> std::same_as<uint64_t>;
+  { H::is_seeded } -> std::convertible_to<bool>;
+};
+
+/**
+ * String hash policies that support case-insensitive hashing additionally:
+ * H::hash_icase(str, seed) == H::operator()(ASCII-lower-case of str, seed)
+ * which folds characters on the fly without copying str.
+ */
+template <class H>
+concept string_icase_hash_policy = string_hash_policy<H>
+  && requires (std::string_view str, uint64_t seed) {
+    { H::hash_icase(str, seed) } -> std::same_as<uint64_t>;
+  };
+
+/**
+ * BKDR hash with one multiplication per byte.
+ */
+struct bkdr_hash_policy {
+  static constexpr auto is_seeded = false;
+
+  static constexpr auto operator()(std::string_view str, uint64_t = 0)
+    -> uint64_t
+  {
+    return bkdr_hash64(str);
+  }
+
+  static constexpr auto hash_icase(std::string_view str, uint64_t = 0)
+    -> uint64_t
+  {
+    auto res = uint64_t{0};
+    for (auto c: str) {
+      res = res * bkdr_hash_default_p + static_cast<uint64_t>(tolower(c));
+    }
+    return res;
+  }
+};
+
+/**
+ * Seeded multiply-xorshift hash that consumes 8 bytes per step.
+ */
+struct wordwise_hash_policy {
+  static constexpr auto is_seeded = true;
+
+  static constexpr auto step(uint64_t h, uint64_t word) -> uint64_t
+  {
+    h = (h ^ word) * 0x9e37'79b9'7f4a'7c15llu;
+    return h ^ (h >> 29);
+  }
+
+  template <bool ICase>
+  static constexpr auto hash_impl(std::string_view str, uint64_t seed)
+    -> uint64_t
+  {
+    const auto* cur = str.data();
+    auto n = str.size();
+    auto h = seed ^ (n * 0xc2b2'ae3d'27d4'eb4fllu);
+    for (; n >= 8; cur += 8, n -= 8) {
+      auto word = impl::load_u64_le(cur);
+      h = step(h, impl::maybe_tolower_u64<ICase>(word));
+    }
+    if (n != 0) {
+      auto word = impl::load_partial_u64_le(cur, n);
+      h = step(h, impl::maybe_tolower_u64<ICase>(word));
+    }
+    h ^= h >> 32;
+    h *= 0xd6e8'feb8'6659'fd93llu;
+    return h ^ (h >> 32);
+  }
+
+  static constexpr auto operator()(std::string_view str, uint64_t seed = 0)
+    -> uint64_t
+  {
+    return hash_impl<false>(str, seed);
+  }
+
+  static constexpr auto hash_icase(std::string_view str, uint64_t seed = 0)
+    -> uint64_t
+  {
+    return hash_impl<true>(str, seed);
+  }
+};
+
+/**
+ * CRC32C hash that uses hardware instructions if available (SSE4.2 on x86-64
+ * or CRC32 extension on ARM), or a table-driven fallback otherwise.
+ * Two 32-bit lanes form the 64-bit result, each of which consumes 8 bytes
+ * per step transformed differently.
+ *
+ * Note that CRC32C is affine over GF(2): if two strings of equal length
+ * collide with some initial value, they collide with any initial value.
+ * Thus the seed is not used as initial value, but multiplied into each word
+ * (which is nonlinear over GF(2)) so that different seeds lead to different
+ * collision patterns.
+ */
+struct crc32c_hash_policy {
+  static constexpr auto is_seeded = true;
+
+  template <bool ICase>
+  static constexpr auto hash_impl(std::string_view str, uint64_t seed)
+    -> uint64_t
+  {
+    const auto* cur = str.data();
+    auto n = str.size();
+    // Odd factors, thus multiplication is a bijection of words
+    auto k = seed * 2 + 1;
+    auto k_lo = k * 0x9e37'79b9'7f4a'7c15llu;
+    auto k_hi = k * 0xc2b2'ae3d'27d4'eb4fllu;
+    auto lo = static_cast<uint32_t>(n);
+    auto hi = ~static_cast<uint32_t>(n);
+    auto step = [&lo, &hi, k_lo, k_hi](uint64_t word) {
+      word = impl::maybe_tolower_u64<ICase>(word);
+      lo = impl::crc32c_u64(lo, word * k_lo);
+      hi = impl::crc32c_u64(hi, std::rotr(word, 32) * k_hi);
+    };
+    for (; n >= 8; cur += 8, n -= 8) {
+      step(impl::load_u64_le(cur));
+    }
+    if (n != 0) {
+      step(impl::load_partial_u64_le(cur, n));
+    }
+    auto h = ((static_cast<uint64_t>(hi) << 32) | lo) ^ seed;
+    h *= 0xbf58'476d'1ce4'e5b9llu;
+    return h ^ (h >> 31);
+  }
+
+  static constexpr auto operator()(std::string_view str, uint64_t seed = 0)
+    -> uint64_t
+  {
+    return hash_impl<false>(str, seed);
+  }
+
+  static constexpr auto hash_icase(std::string_view str, uint64_t seed = 0)
+    -> uint64_t
+  {
+    return hash_impl<true>(str, seed);
+  }
+};
 } // namespace reflect_cpp26
 
 #endif // REFLECT_CPP26_UTILS_STRING_HASH_HPP
@@ -4,12 +4,39 @@
 
 #ifdef ENABLE_BINARY_SEARCH_CHECK
 #define REFLECT_CPP26_ENUM_ENABLE_HASH_TABLE_LOOKUP_THRESHOLD 9999
+#define REFLECT_CPP26_ENUM_ENABLE_PERFECT_HASH_LOOKUP_THRESHOLD 9999
 #define REFLECT_CPP26_ENUM_ENABLE_BINARY_SEARCH_THRESHOLD 0
+#define REFLECT_CPP26_ENUM_DISABLE_CHAR_DISPATCH_THRESHOLD 0
 #endif
 
 #ifdef ENABLE_LINEAR_SEARCH_CHECK
 #define REFLECT_CPP26_ENUM_ENABLE_HASH_TABLE_LOOKUP_THRESHOLD 9999
+#define REFLECT_CPP26_ENUM_ENABLE_PERFECT_HASH_LOOKUP_THRESHOLD 9999
 #define REFLECT_CPP26_ENUM_ENABLE_BINARY_SEARCH_THRESHOLD 9999
+#define REFLECT_CPP26_ENUM_DISABLE_CHAR_DISPATCH_THRESHOLD 0
+#endif
+
+#ifdef ENABLE_PERFECT_HASH_CHECK
+#define REFLECT_CPP26_ENUM_ENABLE_PERFECT_HASH_LOOKUP_THRESHOLD 0
+#define REFLECT_CPP26_ENUM_DISABLE_CHAR_DISPATCH_THRESHOLD 0
+#endif
+
+#ifdef ENABLE_WORDWISE_HASH_CHECK
+#define REFLECT_CPP26_ENUM_HASH_POLICY reflect_cpp26::wordwise_hash_policy
+#define REFLECT_CPP26_ENUM_DISABLE_CHAR_DISPATCH_THRESHOLD 0
+#endif
+
+#ifdef ENABLE_CRC32C_HASH_CHECK
+#define REFLECT_CPP26_ENUM_HASH_POLICY reflect_cpp26::crc32c_hash_policy
+#define REFLECT_CPP26_ENUM_DISABLE_CHAR_DISPATCH_THRESHOLD 0
+#endif
+
+#ifdef ENABLE_CHAR_DISPATCH_CHECK
+#define REFLECT_CPP26_ENUM_DISABLE_CHAR_DISPATCH_THRESHOLD 9999
+#endif
+
+#ifdef ENABLE_SWITCH_JUMP_TABLE_CHECK
+#define REFLECT_CPP26_ENUM_DISABLE_SWITCH_CASES_THRESHOLD 0
 #endif
 
 #include <reflect_cpp26/enum/impl/constants.hpp>
@@ -20,3 +47,22 @@ namespace enum_constants = reflect_cpp26::impl::enum_constants;
 static_assert(enum_constants::enable_hash_table_lookup_threshold_is_custom);
 static_assert(enum_constants::enable_binary_search_threshold_is_custom);
 #endif
+
+#if defined(ENABLE_BINARY_SEARCH_CHECK) || defined(ENABLE_LINEAR_SEARCH_CHECK) \
+ || defined(ENABLE_PERFECT_HASH_CHECK)
+static_assert(enum_constants::enable_perfect_hash_lookup_threshold_is_custom);
+#endif
+
+#if defined(ENABLE_WORDWISE_HASH_CHECK) || defined(ENABLE_CRC32C_HASH_CHECK)
+static_assert(enum_constants::hash_policy_is_custom);
+#endif
+
+#if defined(ENABLE_BINARY_SEARCH_CHECK) || defined(ENABLE_LINEAR_SEARCH_CHECK) \
+ || defined(ENABLE_PERFECT_HASH_CHECK) || defined(ENABLE_WORDWISE_HASH_CHECK) \
+ || defined(ENABLE_CRC32C_HASH_CHECK) || defined(ENABLE_CHAR_DISPATCH_CHECK)
+static_assert(enum_constants::disable_char_dispatch_threshold_is_custom);
+#endif
+
+#ifdef ENABLE_SWITCH_JUMP_TABLE_CHECK
+static_assert(enum_constants::disable_switch_cases_threshold_is_custom);
+#endif
@@ -2,7 +2,12 @@
 #include "tests/test_options.hpp"
 #include <reflect_cpp26/enum/impl/hash_collision_check.hpp>
 
+using reflect_cpp26::impl::enum_hash_seed_v;
+using reflect_cpp26::impl::enum_name_has_hash_collision;
 using reflect_cpp26::impl::enum_name_has_hash_collision_v;
+using reflect_cpp26::bkdr_hash_policy;
+using reflect_cpp26::crc32c_hash_policy;
+using reflect_cpp26::wordwise_hash_policy;
 
 static_assert(! enum_name_has_hash_collision_v<foo_signed>);
 static_assert(! enum_name_has_hash_collision_v<foo_signed_reorder>);
@@ -17,6 +22,30 @@ static_assert(! enum_name_has_hash_collision_v<color>);
 static_assert(! enum_name_has_hash_collision_v<terminal_color>);
 static_assert(enum_name_has_hash_collision_v<hash_collision>);
 
+// BKDR hash is not seeded.
+static_assert(0 == enum_hash_seed_v<hash_collision, bkdr_hash_policy>);
+static_assert(enum_name_has_hash_collision_v<
+  hash_collision, bkdr_hash_policy>);
+// Seeded hash policies get rid of collision
+static_assert(! enum_name_has_hash_collision_v<
+  hash_collision, wordwise_hash_policy>);
+static_assert(! enum_name_has_hash_collision_v<
+  hash_collision, crc32c_hash_policy>);
+// Collides with seed 0 of crc32c_hash_policy (see test_utils_misc.cpp).
+// Retrying with another seed gets rid of collision.
+enum class crc32c_collision {
+  bhnibdlefngncjfa,
+  niomgpdhacjiggib,
+};
+static_assert(enum_name_has_hash_collision<
+  crc32c_collision, crc32c_hash_policy>(0));
+static_assert(0 != enum_hash_seed_v<crc32c_collision, crc32c_hash_policy>);
+static_assert(! enum_name_has_hash_collision_v<
+  crc32c_collision, crc32c_hash_policy>);
+
+static_assert(! enum_name_has_hash_collision_v<color, wordwise_hash_policy>);
+static_assert(! enum_name_has_hash_collision_v<color, crc32c_hash_policy>);
+
 TEST(EnumImpl, HashCollisionCheck) {
   EXPECT_TRUE(true); // All test cases done by static assertions above.
 }
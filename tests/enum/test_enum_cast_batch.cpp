@@ -0,0 +1,107 @@
+#include "tests/enum/enum_test_options.hpp"
+#include "tests/enum/test_cases.hpp"
+
+#ifdef ENABLE_FULL_HEADER_TEST
+#include <reflect_cpp26/enum.hpp>
+#else
+#include <reflect_cpp26/enum/enum_cast.hpp>
+#include <reflect_cpp26/enum/enum_cast_batch.hpp>
+#include <reflect_cpp26/enum/enum_entries.hpp>
+#endif
+
+using namespace reflect_cpp26;
+
+#ifdef ENABLE_BINARY_SEARCH_CHECK
+#define TEST_SUITE_NAME EnumCastBatchBinarySearch
+#endif
+
+#ifdef ENABLE_PERFECT_HASH_CHECK
+#define TEST_SUITE_NAME EnumCastBatchPerfectHash
+#endif
+
+#ifndef TEST_SUITE_NAME
+#define TEST_SUITE_NAME EnumCastBatch
+#endif
+
+// All names of E (repeated, in reversed order), mixed with invalid inputs
+template <class E>
+auto make_batch_inputs() -> std::vector<std::string_view>
+{
+  auto res = std::vector<std::string_view>{};
+  for (auto round = 0; round < 3; round++) {
+    for (auto [_, str]: enum_entries<E>() | std::views::reverse) {
+      res.push_back(str);
+      if (res.size() % 7 == 0) {
+        res.push_back("");
+      }
+      if (res.size() % 11 == 0) {
+        res.push_back("hello_world");
+      }
+    }
+    res.push_back("-");
+    res.push_back("ZERO");
+  }
+  return res;
+}
+
+template <class E>
+void test_enum_cast_batch_common()
+{
+  auto inputs = make_batch_inputs<E>();
+  auto n = inputs.size();
+
+  auto outputs = std::vector<std::optional<E>>(n, E{});
+  auto success_count = enum_cast_batch<E>(inputs, outputs);
+  auto expected_success_count = 0zU;
+  for (auto i = 0zU; i < n; i++) {
+    auto expected = enum_cast<E>(inputs[i]);
+    expected_success_count += expected.has_value();
+    EXPECT_EQ(expected, outputs[i]) << "input = '" << inputs[i] << "'";
+  }
+  EXPECT_EQ(expected_success_count, success_count);
+
+  auto values = std::vector<E>(n, E{});
+  auto error_bitmap = std::vector<uint64_t>((n + 63) / 64, ~uint64_t{0});
+  auto error_count = enum_cast_batch<E>(inputs, values, error_bitmap);
+  EXPECT_EQ(n - expected_success_count, error_count);
+  for (auto i = 0zU; i < n; i++) {
+    auto expected = enum_cast<E>(inputs[i]);
+    auto is_error = ((error_bitmap[i / 64] >> (i % 64)) & 1u) != 0;
+    EXPECT_EQ(!expected.has_value(), is_error) << "at index " << i;
+    EXPECT_EQ(expected.value_or(E{}), values[i]) << "at index " << i;
+  }
+}
+
+constexpr auto count_batch_success(std::span<const std::string_view> inputs)
+{
+  auto outputs = std::array<std::optional<terminal_color>, 4>{};
+  return enum_cast_batch<terminal_color>(inputs, outputs);
+}
+
+TEST(TEST_SUITE_NAME, FooSigned) {
+  test_enum_cast_batch_common<foo_signed>();
+}
+
+TEST(TEST_SUITE_NAME, BarUnsigned) {
+  test_enum_cast_batch_common<bar_unsigned>();
+}
+
+TEST(TEST_SUITE_NAME, Empty) {
+  test_enum_cast_batch_common<empty>();
+}
+
+TEST(TEST_SUITE_NAME, Color) {
+  test_enum_cast_batch_common<color>();
+}
+
+TEST(TEST_SUITE_NAME, TerminalColor)
+{
+  test_enum_cast_batch_common<terminal_color>();
+
+  constexpr std::string_view inputs[] = {"red", "bright_cyan", "", "pink"};
+  EXPECT_EQ_STATIC(2zU, count_batch_success(inputs));
+}
+
+TEST(TEST_SUITE_NAME, HashCollision) {
+  test_enum_cast_batch_common<hash_collision>();
+}
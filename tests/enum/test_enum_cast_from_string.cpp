@@ -17,6 +17,22 @@ using namespace reflect_cpp26;
 #define TEST_SUITE_NAME EnumCastFromStringLinearSearch
 #endif
 
+#ifdef ENABLE_PERFECT_HASH_CHECK
+#define TEST_SUITE_NAME EnumCastFromStringPerfectHash
+#endif
+
+#ifdef ENABLE_WORDWISE_HASH_CHECK
+#define TEST_SUITE_NAME EnumCastFromStringWordwiseHash
+#endif
+
+#ifdef ENABLE_CRC32C_HASH_CHECK
+#define TEST_SUITE_NAME EnumCastFromStringCrc32cHash
+#endif
+
+#ifdef ENABLE_CHAR_DISPATCH_CHECK
+#define TEST_SUITE_NAME EnumCastFromStringCharDispatch
+#endif
+
 #ifndef TEST_SUITE_NAME
 #define TEST_SUITE_NAME EnumCastFromString
 #endif
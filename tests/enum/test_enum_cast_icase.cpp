@@ -0,0 +1,146 @@
+#include "tests/enum/enum_test_options.hpp"
+#include "tests/enum/test_cases.hpp"
+
+#ifdef ENABLE_FULL_HEADER_TEST
+#include <reflect_cpp26/enum.hpp>
+#else
+#include <reflect_cpp26/enum/enum_cast.hpp>
+#include <reflect_cpp26/enum/enum_contains.hpp>
+#endif
+
+using namespace reflect_cpp26;
+
+#ifdef ENABLE_BINARY_SEARCH_CHECK
+#define TEST_SUITE_NAME EnumCastICaseBinarySearch
+#endif
+
+#ifdef ENABLE_PERFECT_HASH_CHECK
+#define TEST_SUITE_NAME EnumCastICasePerfectHash
+#endif
+
+#ifdef ENABLE_WORDWISE_HASH_CHECK
+#define TEST_SUITE_NAME EnumCastICaseWordwiseHash
+#endif
+
+#ifdef ENABLE_CRC32C_HASH_CHECK
+#define TEST_SUITE_NAME EnumCastICaseCrc32cHash
+#endif
+
+#ifndef TEST_SUITE_NAME
+#define TEST_SUITE_NAME EnumCastICase
+#endif
+
+enum class icase_rep {
+  none = 0,
+  None = 0,
+  NONE = 0,
+  some = 1,
+  Many = 2,
+};
+
+// Every name in upper case and alternating case is accepted.
+template <class E>
+void test_all_names_icase()
+{
+  for (auto [e, str]: enum_entries<E>()) {
+    auto upper = std::string{str};
+    auto alternating = std::string{str};
+    for (auto i = 0zU, n = upper.size(); i < n; i++) {
+      upper[i] = toupper(upper[i]);
+      alternating[i] = (i % 2 == 0) ? toupper(str[i]) : tolower(str[i]);
+    }
+    EXPECT_EQ(e, enum_cast_icase<E>(str)) << "name = " << str;
+    EXPECT_EQ(e, enum_cast_icase<E>(upper)) << "name = " << upper;
+    EXPECT_EQ(e, enum_cast_icase<E>(alternating)) << "name = " << alternating;
+    EXPECT_TRUE(enum_contains_icase<E>(upper)) << "name = " << upper;
+  }
+}
+
+template <class E>
+void test_invalid_cases_common()
+{
+  ASSERT_EQ_STATIC(std::nullopt, enum_cast_icase<E>("hello_world"));
+  ASSERT_EQ_STATIC(std::nullopt, enum_cast_icase<E>(" zero "));
+  ASSERT_EQ_STATIC(std::nullopt, enum_cast_icase<E>("0"));
+  ASSERT_EQ_STATIC(std::nullopt, enum_cast_icase<E>(""));
+  ASSERT_EQ_STATIC(std::nullopt, enum_cast_icase<E>("-"));
+  ASSERT_FALSE_STATIC(enum_contains_icase<E>("hello_world"));
+  ASSERT_FALSE_STATIC(enum_contains_icase<E>(""));
+}
+
+TEST(TEST_SUITE_NAME, FooSigned)
+{
+  ASSERT_EQ_STATIC(foo_signed::zero, enum_cast_icase<foo_signed>("ZERO"));
+  ASSERT_EQ_STATIC(foo_signed::zero, enum_cast_icase<foo_signed>("zErO"));
+  ASSERT_EQ_STATIC(foo_signed::invalid,
+    enum_cast_icase<foo_signed>("Invalid"));
+  ASSERT_EQ_STATIC(std::nullopt, enum_cast_icase<foo_signed>("ZER0"));
+  ASSERT_TRUE_STATIC(enum_contains_icase<foo_signed>("SEVEN"));
+  test_all_names_icase<foo_signed>();
+  test_invalid_cases_common<foo_signed>();
+}
+
+TEST(TEST_SUITE_NAME, FooSignedRep)
+{
+  ASSERT_EQ_STATIC(foo_signed_rep::one,
+    enum_cast_icase<foo_signed_rep>("YI"));
+  ASSERT_EQ_STATIC(foo_signed_rep::two,
+    enum_cast_icase<foo_signed_rep>("Er"));
+  test_all_names_icase<foo_signed_rep>();
+  test_invalid_cases_common<foo_signed_rep>();
+}
+
+TEST(TEST_SUITE_NAME, BarUnsigned)
+{
+  ASSERT_EQ_STATIC(bar_unsigned::fourteen,
+    enum_cast_icase<bar_unsigned>("FourTeen"));
+  test_all_names_icase<bar_unsigned>();
+  test_invalid_cases_common<bar_unsigned>();
+}
+
+TEST(TEST_SUITE_NAME, Empty)
+{
+  test_invalid_cases_common<empty>();
+  ASSERT_EQ_STATIC(std::nullopt, enum_cast_icase<empty>("ZERO"));
+}
+
+TEST(TEST_SUITE_NAME, Single)
+{
+  ASSERT_EQ_STATIC(single::value, enum_cast_icase<single>("VALUE"));
+  test_invalid_cases_common<single>();
+}
+
+TEST(TEST_SUITE_NAME, Color)
+{
+  ASSERT_EQ_STATIC(color::hot_pink, enum_cast_icase<color>("HOT_PINK"));
+  ASSERT_EQ_STATIC(color::light_golden_rod_yellow,
+    enum_cast_icase<color>("Light_Golden_Rod_Yellow"));
+  ASSERT_EQ_STATIC(std::nullopt, enum_cast_icase<color>("HOT-PINK"));
+  test_all_names_icase<color>();
+  test_invalid_cases_common<color>();
+}
+
+TEST(TEST_SUITE_NAME, TerminalColor)
+{
+  test_all_names_icase<terminal_color>();
+  test_invalid_cases_common<terminal_color>();
+}
+
+TEST(TEST_SUITE_NAME, HashCollision)
+{
+  ASSERT_EQ_STATIC(hash_collision::_wSYZDRpiQJf8Rfv,
+    enum_cast_icase<hash_collision>("_WSYZDRPIQJF8RFV"));
+  test_all_names_icase<hash_collision>();
+}
+
+TEST(TEST_SUITE_NAME, Rep)
+{
+  // Names equal with case ignored are merged since values are the same
+  ASSERT_EQ_STATIC(icase_rep::none, enum_cast_icase<icase_rep>("nOnE"));
+  ASSERT_EQ_STATIC(icase_rep::Many, enum_cast_icase<icase_rep>("many"));
+  ASSERT_EQ_STATIC(icase_rep::some, enum_cast_icase<icase_rep>("SOME"));
+  ASSERT_EQ_STATIC(std::nullopt, enum_cast_icase<icase_rep>("nones"));
+  // Case-sensitive version is not affected
+  ASSERT_EQ_STATIC(std::nullopt, enum_cast<icase_rep>("many"));
+  test_all_names_icase<icase_rep>();
+}
@@ -5,6 +5,7 @@
 #include <reflect_cpp26/enum.hpp>
 #else
 #include <reflect_cpp26/enum/enum_contains.hpp>
+#include <reflect_cpp26/enum/enum_entries.hpp>
 #endif
 
 using namespace reflect_cpp26;
@@ -312,6 +313,34 @@ static_assert(enum_contains<hash_collision>(0));
 static_assert(enum_contains<hash_collision>(1));
 static_assert(NOT enum_contains<hash_collision>(-1));
 
+// Large sparse enum with negative values, without any continuous run
+enum class sparse_signed: int32_t {
+  m1000 = -1000, m500 = -500, m200 = -200, m100 = -100, m50 = -50, m20 = -20,
+  m10 = -10, m5 = -5, p5 = 5, p10 = 10, p20 = 20, p50 = 50, p100 = 100,
+  p200 = 200, p500 = 500, p1000 = 1000, p2000 = 2000,
+};
+
+constexpr bool test_sparse_signed()
+{
+  for (auto [e, _]: enum_entries<sparse_signed>()) {
+    auto v = std::to_underlying(e);
+    if (!enum_contains<sparse_signed>(v)) {
+      return false;
+    }
+    if (enum_contains<sparse_signed>(v + 1)
+        || enum_contains<sparse_signed>(v - 1)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static_assert(test_sparse_signed());
+static_assert(NOT enum_contains<sparse_signed>(-2000));
+static_assert(NOT enum_contains<sparse_signed>(3000));
+static_assert(NOT enum_contains<sparse_signed>(0));
+static_assert(NOT enum_contains<sparse_signed>(static_cast<uint32_t>(-5)));
+
 TEST(EnumContainsInteger, StaticAll) {
   EXPECT_TRUE(true); // All test cases done by static assertions above.
 }
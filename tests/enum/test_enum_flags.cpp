@@ -0,0 +1,95 @@
+#include "tests/enum/enum_test_options.hpp"
+#include "tests/enum/test_cases.hpp"
+
+#ifdef ENABLE_FULL_HEADER_TEST
+#include <reflect_cpp26/enum.hpp>
+#else
+#include <reflect_cpp26/enum/enum_flags.hpp>
+#endif
+
+using namespace reflect_cpp26;
+
+enum class permission: uint32_t {
+  none = 0,
+  read = 1,
+  write = 2,
+  exec = 4,
+  admin = 0x8000'0000u,
+  read_write = 3, // Not a flag since multiple bits are set
+};
+
+enum class no_zero: int8_t {
+  x = 1,
+  y = 2,
+  z = -128, // Sign bit
+};
+
+template <class E>
+constexpr auto flags_name(E value) -> std::string
+{
+  auto buffer = std::string(enum_flags_name_max_size<E>(), '\0');
+  auto size = enum_flags_name(value, buffer.data());
+  if (size == npos) {
+    return "<npos>";
+  }
+  buffer.resize(size);
+  return buffer;
+}
+
+TEST(EnumFlags, MaxSize)
+{
+  // "read|write|exec|admin"
+  EXPECT_EQ_STATIC(21, enum_flags_name_max_size<permission>());
+  // "x|y|z"
+  EXPECT_EQ_STATIC(5, enum_flags_name_max_size<no_zero>());
+  // "one|two" v.s. "zero"
+  EXPECT_EQ_STATIC(7, enum_flags_name_max_size<bar_unsigned>());
+  EXPECT_EQ_STATIC(0, enum_flags_name_max_size<empty>());
+}
+
+TEST(EnumFlags, Name)
+{
+  using enum permission;
+  EXPECT_EQ_STATIC("none", flags_name(none));
+  EXPECT_EQ_STATIC("read", flags_name(read));
+  EXPECT_EQ_STATIC("read|write", flags_name(read_write));
+  EXPECT_EQ_STATIC("read|exec", flags_name(static_cast<permission>(5)));
+  EXPECT_EQ_STATIC("read|write|exec|admin",
+    flags_name(static_cast<permission>(0x8000'0007u)));
+  EXPECT_EQ_STATIC("<npos>", flags_name(static_cast<permission>(8)));
+  EXPECT_EQ_STATIC("<npos>", flags_name(static_cast<permission>(9)));
+
+  EXPECT_EQ_STATIC("", flags_name(static_cast<no_zero>(0)));
+  EXPECT_EQ_STATIC("x|z", flags_name(static_cast<no_zero>(-127)));
+  EXPECT_EQ_STATIC("<npos>", flags_name(static_cast<no_zero>(4)));
+}
+
+TEST(EnumFlags, Cast)
+{
+  using enum permission;
+  EXPECT_EQ_STATIC(none, enum_flags_cast<permission>("none"));
+  EXPECT_EQ_STATIC(exec, enum_flags_cast<permission>("exec"));
+  EXPECT_EQ_STATIC(read_write, enum_flags_cast<permission>("write|read"));
+  EXPECT_EQ_STATIC(static_cast<permission>(0x8000'0007u),
+    enum_flags_cast<permission>("read_write|exec|admin"));
+  EXPECT_EQ_STATIC(read, enum_flags_cast<permission>("read|read|none"));
+
+  EXPECT_EQ_STATIC(std::nullopt, enum_flags_cast<permission>(""));
+  EXPECT_EQ_STATIC(std::nullopt, enum_flags_cast<permission>("|"));
+  EXPECT_EQ_STATIC(std::nullopt, enum_flags_cast<permission>("read|"));
+  EXPECT_EQ_STATIC(std::nullopt, enum_flags_cast<permission>("|read"));
+  EXPECT_EQ_STATIC(std::nullopt, enum_flags_cast<permission>("read | write"));
+  EXPECT_EQ_STATIC(std::nullopt, enum_flags_cast<permission>("read|delete"));
+
+  EXPECT_EQ_STATIC(static_cast<no_zero>(-127),
+    enum_flags_cast<no_zero>("z|x"));
+}
+
+TEST(EnumFlags, RoundTrip)
+{
+  for (auto bits = 0u; bits < 16u; bits++) {
+    auto value = static_cast<permission>((bits & 7u) | (bits & 8u) << 28);
+    auto name = flags_name(value);
+    EXPECT_EQ(value, enum_flags_cast<permission>(name)) << "name = " << name;
+  }
+}
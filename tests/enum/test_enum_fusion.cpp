@@ -0,0 +1,89 @@
+#include "tests/enum/enum_test_options.hpp"
+#include "tests/enum/test_cases.hpp"
+
+#ifdef ENABLE_FULL_HEADER_TEST
+#include <reflect_cpp26/enum.hpp>
+#else
+#include <reflect_cpp26/enum/enum_fusion.hpp>
+#include <reflect_cpp26/enum/enum_switch.hpp>
+#include <reflect_cpp26/enum/enum_values.hpp>
+#endif
+
+using namespace reflect_cpp26;
+
+enum class state { idle, running, stopped };
+enum class event { start = 10, stop = 20, reset = 30, tick = 40 };
+
+TEST(EnumFusion, Basic)
+{
+  EXPECT_EQ_STATIC(12, (enum_fusion_extent<state, event>()));
+  EXPECT_EQ_STATIC(0, enum_fusion(state::idle, event::start));
+  EXPECT_EQ_STATIC(1, enum_fusion(state::idle, event::stop));
+  EXPECT_EQ_STATIC(4, enum_fusion(state::running, event::start));
+  EXPECT_EQ_STATIC(11, enum_fusion(state::stopped, event::tick));
+  EXPECT_EQ_STATIC(npos, enum_fusion(state::idle, static_cast<event>(15)));
+  EXPECT_EQ_STATIC(npos, enum_fusion(static_cast<state>(3), event::tick));
+
+  // Duplicated values share the same key
+  EXPECT_EQ_STATIC(enum_fusion(foo_signed_rep::one, event::stop),
+                   enum_fusion(foo_signed_rep::yi, event::stop));
+  // Variadic
+  EXPECT_EQ_STATIC(12 * 3, (enum_fusion_extent<state, event, state>()));
+  EXPECT_EQ_STATIC((1 * 4 + 3) * 3 + 2,
+    enum_fusion(state::running, event::tick, state::stopped));
+  EXPECT_EQ_STATIC(0, enum_fusion_extent<empty>());
+
+  // Keys are distinct and dense
+  auto keys = std::vector<size_t>{};
+  for (auto s: enum_values<state>()) {
+    for (auto e: enum_values<event>()) {
+      keys.push_back(enum_fusion(s, e));
+    }
+  }
+  std::ranges::sort(keys);
+  for (auto i = 0zU; i < keys.size(); i++) {
+    EXPECT_EQ(i, keys[i]);
+  }
+}
+
+// Next state of transition
+struct transit_t {
+  template <state S, event E>
+  constexpr auto operator()(constant<S>, constant<E>) const -> state
+  {
+    if constexpr (E == event::reset) {
+      return state::idle;
+    } else if constexpr (S == state::idle && E == event::start) {
+      return state::running;
+    } else if constexpr (S == state::running && E == event::stop) {
+      return state::stopped;
+    } else {
+      return S;
+    }
+  }
+};
+
+TEST(EnumFusion, Switch2)
+{
+  EXPECT_EQ_STATIC(state::running,
+    enum_switch2<state>(transit_t{}, state::idle, event::start));
+  EXPECT_EQ_STATIC(state::idle,
+    enum_switch2<state>(transit_t{}, state::stopped, event::reset));
+  EXPECT_EQ_STATIC(state::running,
+    enum_switch2<state>(transit_t{}, state::running, event::tick));
+  EXPECT_EQ_STATIC(std::nullopt,
+    enum_switch2<state>(transit_t{}, state::running, static_cast<event>(0)));
+
+  EXPECT_EQ_STATIC(state::stopped,
+    enum_switch2(transit_t{}, state::running, event::stop, state::idle));
+  EXPECT_EQ_STATIC(state::stopped, enum_switch2(transit_t{},
+    static_cast<state>(-1), event::stop, state::stopped));
+
+  auto visited = std::vector<std::pair<state, event>>{};
+  auto record = [&visited](auto s, auto e) {
+    visited.emplace_back(s.value, e.value);
+  };
+  enum_switch2(record, state::stopped, event::reset);
+  enum_switch2(record, state::idle, static_cast<event>(41));
+  EXPECT_EQ((std::vector{std::pair{state::stopped, event::reset}}), visited);
+}
@@ -328,3 +328,28 @@ TEST(EnumIndex, HashCollision)
   ASSERT_EQ_STATIC(npos, enum_index<by_value>(static_cast<hash_collision>(2)));
   ASSERT_EQ_STATIC(npos, enum_index<by_name>(static_cast<hash_collision>(123)));
 }
+
+// Values are spread over [-10, 40] with holes: slot table is used.
+enum class bounded_sparse: int8_t {
+  a = -10, b = -7, c = -6, d = 0, e = 3, f = 9, g = 10, h = 11,
+  i = 20, j = 27, k = 33, l = 40,
+};
+
+TEST(EnumIndex, BoundedSparse)
+{
+  constexpr const auto& tb = impl::enum_value_entry_table_v<bounded_sparse>;
+  ASSERT_EQ_STATIC(51, tb.slots.size());
+
+  ASSERT_EQ_STATIC(0, enum_index<by_value>(bounded_sparse::a));
+  ASSERT_EQ_STATIC(3, enum_index<by_value>(bounded_sparse::d));
+  ASSERT_EQ_STATIC(7, enum_index<by_value>(bounded_sparse::h));
+  ASSERT_EQ_STATIC(11, enum_index<by_value>(bounded_sparse::l));
+  ASSERT_EQ_STATIC(5, enum_index<by_name>(bounded_sparse::f));
+
+  ASSERT_EQ_STATIC(npos, enum_index(static_cast<bounded_sparse>(-11)));
+  ASSERT_EQ_STATIC(npos, enum_index(static_cast<bounded_sparse>(-9)));
+  ASSERT_EQ_STATIC(npos, enum_index(static_cast<bounded_sparse>(1)));
+  ASSERT_EQ_STATIC(npos, enum_index(static_cast<bounded_sparse>(39)));
+  ASSERT_EQ_STATIC(npos, enum_index(static_cast<bounded_sparse>(41)));
+  ASSERT_EQ_STATIC(npos, enum_index(static_cast<bounded_sparse>(-128)));
+}
@@ -0,0 +1,126 @@
+#include "tests/enum/enum_test_options.hpp"
+
+#ifdef ENABLE_FULL_HEADER_TEST
+#include <reflect_cpp26/enum.hpp>
+#else
+#include <reflect_cpp26/enum/enum_cast.hpp>
+#include <reflect_cpp26/enum/enum_contains.hpp>
+#include <reflect_cpp26/enum/enum_entries.hpp>
+#include <reflect_cpp26/enum/enum_index.hpp>
+#include <reflect_cpp26/enum/enum_names.hpp>
+#include <reflect_cpp26/enum/enum_values.hpp>
+#endif
+#include <reflect_cpp26/enum/impl/enum_search_options.hpp>
+
+using namespace reflect_cpp26;
+using enum enum_entry_order;
+
+// Generates 16 * 16 * 16 enumerators e_0_0_0, e_0_0_1, ..., e_f_f_f
+// whose values are 0, 1, ..., 4095.
+// Distinct macros per level since a macro can not expand itself.
+#define HEX_W(M, P) M(P##0) M(P##1) M(P##2) M(P##3) M(P##4) M(P##5) \
+  M(P##6) M(P##7) M(P##8) M(P##9) M(P##a) M(P##b) M(P##c) M(P##d)   \
+  M(P##e) M(P##f)
+#define HEX_X(M, P) M(P##0) M(P##1) M(P##2) M(P##3) M(P##4) M(P##5) \
+  M(P##6) M(P##7) M(P##8) M(P##9) M(P##a) M(P##b) M(P##c) M(P##d)   \
+  M(P##e) M(P##f)
+#define HEX_Y(M, P) M(P##0) M(P##1) M(P##2) M(P##3) M(P##4) M(P##5) \
+  M(P##6) M(P##7) M(P##8) M(P##9) M(P##a) M(P##b) M(P##c) M(P##d)   \
+  M(P##e) M(P##f)
+#define HEX_Z(M, P) M(P##0) M(P##1) M(P##2) M(P##3) M(P##4) M(P##5) \
+  M(P##6) M(P##7) M(P##8) M(P##9) M(P##a) M(P##b) M(P##c) M(P##d)   \
+  M(P##e) M(P##f)
+#define LARGE_ENTRY(P) P,
+#define LARGE_ROW(P) HEX_Z(LARGE_ENTRY, P##_)
+#define LARGE_BLOCK(P) HEX_Y(LARGE_ROW, P##_)
+
+#define HUGE_BLOCK(P) HEX_X(LARGE_BLOCK, P##_)
+
+enum class large: uint16_t {
+  HEX_X(LARGE_BLOCK, e_)
+};
+
+// 16^4 enumerators e_0_0_0_0, ..., e_f_f_f_f whose values are 0, 1, ...,
+// 65535, plus tail = 65536. Indices do not fit in 16 bits, and hash tables
+// of packed entries are not applicable.
+enum class huge: uint32_t {
+  HEX_W(HUGE_BLOCK, e_)
+  tail,
+};
+
+#undef HEX_W
+#undef HEX_X
+#undef HEX_Y
+#undef HEX_Z
+#undef LARGE_ENTRY
+#undef LARGE_ROW
+#undef LARGE_BLOCK
+#undef HUGE_BLOCK
+
+TEST(EnumLarge, Count)
+{
+  EXPECT_EQ_STATIC(4096, enum_count<large>());
+  EXPECT_EQ_STATIC(4096, enum_values<large>().size());
+  EXPECT_EQ_STATIC(4096, enum_entries<large>().size());
+}
+
+TEST(EnumLarge, Name)
+{
+  EXPECT_EQ_STATIC("e_0_0_0", enum_name(large::e_0_0_0));
+  EXPECT_EQ_STATIC("e_1_2_3", enum_name(static_cast<large>(0x123)));
+  EXPECT_EQ_STATIC("e_f_f_f", enum_name(static_cast<large>(0xfff)));
+  EXPECT_EQ_STATIC("", enum_name(static_cast<large>(0x1000)));
+
+  EXPECT_EQ_STATIC("e_a_b_c", enum_names<large>()[0xabc]);
+  EXPECT_EQ_STATIC("e_f_f_f", (enum_names<large, by_name>().back()));
+}
+
+TEST(EnumLarge, Cast)
+{
+  EXPECT_EQ_STATIC(large::e_0_0_0, enum_cast<large>("e_0_0_0"));
+  EXPECT_EQ_STATIC(large::e_7_e_1, enum_cast<large>("e_7_e_1"));
+  EXPECT_EQ_STATIC(large::e_f_f_f, enum_cast<large>(0xfff));
+  EXPECT_EQ_STATIC(std::nullopt, enum_cast<large>("e_f_f_f_"));
+  EXPECT_EQ_STATIC(std::nullopt, enum_cast<large>(0x1000));
+}
+
+TEST(EnumLarge, IndexAndContains)
+{
+  EXPECT_EQ_STATIC(0x7e1, enum_index(large::e_7_e_1));
+  EXPECT_EQ_STATIC(0x7e1, enum_index<by_value>(large::e_7_e_1));
+  EXPECT_EQ_STATIC(0x7e1, enum_index<by_name>(large::e_7_e_1));
+  EXPECT_TRUE_STATIC(enum_contains(large::e_d_0_9));
+  EXPECT_FALSE_STATIC(enum_contains(static_cast<large>(-1)));
+}
+
+TEST(EnumLarge, MoreThan65535Entries)
+{
+  EXPECT_EQ_STATIC(65537, enum_count<huge>());
+  // Falls back to searching the sorted hash list
+  EXPECT_FALSE_STATIC(impl::enum_fits_packed_hash_entry_v<huge>);
+  EXPECT_FALSE_STATIC(impl::enum_hash_uses_perfect_hash_v<huge>);
+  EXPECT_FALSE_STATIC(impl::enum_hash_uses_table_lookup_v<huge>);
+
+  EXPECT_EQ_STATIC("e_0_0_0_0", enum_name(huge::e_0_0_0_0));
+  EXPECT_EQ_STATIC("e_a_b_c_d", enum_name(static_cast<huge>(0xabcd)));
+  EXPECT_EQ_STATIC("tail", enum_name(huge::tail));
+  EXPECT_EQ_STATIC("", enum_name(static_cast<huge>(0x10001)));
+
+  EXPECT_EQ_STATIC(huge::e_0_0_0_0, enum_cast<huge>("e_0_0_0_0"));
+  EXPECT_EQ_STATIC(huge::e_7_e_1_9, enum_cast<huge>("e_7_e_1_9"));
+  EXPECT_EQ_STATIC(huge::tail, enum_cast<huge>("tail"));
+  EXPECT_EQ_STATIC(huge::tail, enum_cast<huge>(0x10000));
+  EXPECT_EQ_STATIC(std::nullopt, enum_cast<huge>("e_f_f_f_f_"));
+  EXPECT_EQ_STATIC(std::nullopt, enum_cast<huge>(0x10001));
+
+  // Indices beyond 16 bits
+  EXPECT_EQ_STATIC(0x10000, enum_index(huge::tail));
+  EXPECT_EQ_STATIC(0x10000, enum_index<by_name>(huge::tail));
+  EXPECT_EQ_STATIC(0x7e19, enum_index<by_name>(huge::e_7_e_1_9));
+  EXPECT_TRUE_STATIC(enum_contains(huge::e_f_f_f_f));
+  EXPECT_FALSE_STATIC(enum_contains(static_cast<huge>(0x10001)));
+
+  for (auto e: enum_values<huge>()) {
+    ASSERT_EQ(e, enum_cast<huge>(enum_name(e))) << enum_name(e);
+  }
+}
@@ -0,0 +1,95 @@
+#include "tests/enum/enum_test_options.hpp"
+#include "tests/enum/test_cases.hpp"
+
+#ifdef ENABLE_FULL_HEADER_TEST
+#include <reflect_cpp26/enum.hpp>
+#else
+#include <reflect_cpp26/enum/enum_lookup_stats.hpp>
+#endif
+
+using namespace reflect_cpp26;
+
+enum class small_dense {
+  a, b, c, d, e,
+};
+
+// Values 0, 3, 6, ..., 57: slot table of 58 slots
+enum class stride_3 {
+  n00 = 0, n01 = 3, n02 = 6, n03 = 9, n04 = 12, n05 = 15, n06 = 18,
+  n07 = 21, n08 = 24, n09 = 27, n10 = 30, n11 = 33, n12 = 36, n13 = 39,
+  n14 = 42, n15 = 45, n16 = 48, n17 = 51, n18 = 54, n19 = 57,
+};
+
+TEST(EnumLookupStats, Empty)
+{
+  constexpr auto stats = enum_lookup_stats<empty>();
+  EXPECT_EQ_STATIC(0, stats.entry_count);
+  EXPECT_EQ_STATIC(enum_value_lookup_kind::empty, stats.value_lookup);
+  EXPECT_EQ_STATIC(enum_name_lookup_kind::empty, stats.name_lookup);
+  EXPECT_EQ_STATIC(0, stats.value_table_bytes);
+  EXPECT_EQ_STATIC(0, stats.name_table_bytes);
+}
+
+TEST(EnumLookupStats, SmallDense)
+{
+  constexpr auto stats = enum_lookup_stats<const small_dense>();
+  EXPECT_EQ_STATIC(5, stats.entry_count);
+  EXPECT_EQ_STATIC(5, stats.unique_count);
+  EXPECT_EQ_STATIC(enum_value_lookup_kind::runs_only, stats.value_lookup);
+  EXPECT_EQ_STATIC(1, stats.value_run_count);
+  EXPECT_EQ_STATIC(5, stats.value_run_coverage);
+  EXPECT_EQ_STATIC(0, stats.value_slot_count);
+  EXPECT_EQ_STATIC(enum_name_lookup_kind::char_dispatch, stats.name_lookup);
+  EXPECT_EQ_STATIC(0, stats.hash_table_size);
+  EXPECT_TRUE_STATIC(stats.name_table_bytes > 0);
+}
+
+TEST(EnumLookupStats, SlotTable)
+{
+  constexpr auto stats = enum_lookup_stats<stride_3>();
+  EXPECT_EQ_STATIC(enum_value_lookup_kind::slot_table, stats.value_lookup);
+  EXPECT_EQ_STATIC(0, stats.value_run_count);
+  EXPECT_EQ_STATIC(58, stats.value_slot_count);
+  EXPECT_TRUE_STATIC(stats.value_table_bytes >= 58 * sizeof(uint16_t));
+  EXPECT_NE_STATIC(enum_name_lookup_kind::char_dispatch, stats.name_lookup);
+  // Load factor >= 1/4 if hash table is made successfully
+  EXPECT_TRUE_STATIC(stats.name_lookup != enum_name_lookup_kind::hash_table
+    || (stats.hash_table_size >= 20 && stats.hash_table_size <= 80
+        && stats.hash_load_factor == 20.0 / stats.hash_table_size));
+}
+
+TEST(EnumLookupStats, Color)
+{
+  constexpr auto stats = enum_lookup_stats<color>();
+  EXPECT_TRUE_STATIC(stats.unique_count < stats.entry_count);
+  EXPECT_EQ_STATIC(enum_value_lookup_kind::binary_search, stats.value_lookup);
+  EXPECT_FALSE_STATIC(stats.has_hash_collision);
+  EXPECT_EQ_STATIC(enum_name_lookup_kind::perfect_hash, stats.name_lookup);
+  EXPECT_EQ_STATIC(stats.entry_count, stats.hash_table_size);
+  EXPECT_EQ_STATIC(1.0, stats.hash_load_factor);
+}
+
+TEST(EnumLookupStats, HashCollision)
+{
+  constexpr auto bkdr_stats =
+    enum_lookup_stats<hash_collision, bkdr_hash_policy>();
+  EXPECT_TRUE_STATIC(bkdr_stats.has_hash_collision);
+  // Names are distinguished by characters before hashing
+  EXPECT_EQ_STATIC(enum_name_lookup_kind::char_dispatch,
+    bkdr_stats.name_lookup);
+
+  constexpr auto wordwise_stats =
+    enum_lookup_stats<hash_collision, wordwise_hash_policy>();
+  EXPECT_FALSE_STATIC(wordwise_stats.has_hash_collision);
+}
+
+TEST(EnumLookupStats, Dump)
+{
+  auto dump = enum_lookup_stats_dump<small_dense, empty>();
+  EXPECT_THAT(dump, testing::StartsWith(
+    "small_dense: entry_count=5 unique_count=5 value_lookup=runs_only "));
+  EXPECT_THAT(dump, testing::HasSubstr(
+    "\nempty: entry_count=0 unique_count=0 value_lookup=empty "));
+  EXPECT_THAT(dump, testing::HasSubstr(" name_lookup=char_dispatch "));
+  EXPECT_EQ(2, std::ranges::count(dump, '\n'));
+}
@@ -0,0 +1,107 @@
+#include "tests/enum/enum_test_options.hpp"
+#include "tests/enum/test_cases.hpp"
+
+#ifdef ENABLE_FULL_HEADER_TEST
+#include <reflect_cpp26/annotations.hpp>
+#include <reflect_cpp26/enum.hpp>
+#else
+#include <reflect_cpp26/annotations/enum_properties.hpp>
+#include <reflect_cpp26/annotations/macros.h>
+#include <reflect_cpp26/enum/enum_map.hpp>
+#include <reflect_cpp26/enum/enum_names.hpp>
+#endif
+
+using namespace reflect_cpp26;
+
+enum class weekday {
+  monday, tuesday, wednesday, thursday, friday, saturday, sunday
+};
+
+// Too few entries to build runs
+enum class traffic_light {
+  red, yellow, green
+};
+
+// Runs are not built with strategies other than automatic
+enum class REFLECT_CPP26_PROPERTY(
+  enum_value_search, annotations::enum_value_search_strategy::linear_search)
+linear_weekday {
+  monday, tuesday, wednesday, thursday, friday, saturday, sunday
+};
+
+static_assert(impl::enum_values_are_indices_v<weekday>);
+static_assert(impl::enum_values_are_indices_v<traffic_light>);
+static_assert(impl::enum_values_are_indices_v<linear_weekday>);
+static_assert(NOT impl::enum_values_are_indices_v<single>);
+static_assert(NOT impl::enum_values_are_indices_v<foo_signed>);
+static_assert(NOT impl::enum_values_are_indices_v<empty>);
+static_assert(2 == impl::enum_unique_index_unchecked(traffic_light::green));
+
+constexpr auto make_weekday_lengths()
+{
+  auto res = enum_map<weekday, size_t>{};
+  res.for_each([](weekday key, size_t& value) {
+    value = enum_name(key).size();
+  });
+  return res;
+}
+
+TEST(EnumMap, Contiguous)
+{
+  constexpr auto lengths = make_weekday_lengths();
+  EXPECT_EQ_STATIC(7, lengths.size());
+  EXPECT_EQ_STATIC(6, lengths[weekday::monday]);
+  EXPECT_EQ_STATIC(9, lengths[weekday::wednesday]);
+  EXPECT_EQ_STATIC(6, lengths[weekday::sunday]);
+  EXPECT_EQ_STATIC(weekday::friday, lengths.key_at(4));
+  EXPECT_EQ_STATIC(nullptr, lengths.find(static_cast<weekday>(7)));
+  EXPECT_EQ_STATIC(nullptr, lengths.find(static_cast<weekday>(-1)));
+
+  auto m = enum_map<weekday, int>{};
+  m[weekday::tuesday] = 2;
+  *m.find(weekday::sunday) += 7;
+  EXPECT_EQ((std::array{0, 2, 0, 0, 0, 0, 7}), m.values);
+  EXPECT_TRUE(m.contains(weekday::saturday));
+  EXPECT_FALSE(m.contains(static_cast<weekday>(100)));
+}
+
+constexpr auto make_foo_signed_map()
+{
+  auto res = enum_map<foo_signed_rep, int>{};
+  res[foo_signed_rep::error] = -2;
+  res[foo_signed_rep::yi] = 1;
+  res[foo_signed_rep::seven] = 7;
+  return res;
+}
+
+TEST(EnumMap, Sparse)
+{
+  constexpr auto m = make_foo_signed_map();
+  // Duplicated values share the same slot
+  EXPECT_EQ_STATIC(9, m.size());
+  EXPECT_EQ_STATIC(1, m[foo_signed_rep::one]);
+  EXPECT_EQ_STATIC(-2, m[foo_signed_rep::error]);
+  EXPECT_EQ_STATIC(0, m[foo_signed_rep::two]);
+  EXPECT_EQ_STATIC(7, *m.find(foo_signed_rep::seven));
+  EXPECT_EQ_STATIC(nullptr, m.find(static_cast<foo_signed_rep>(3)));
+  EXPECT_EQ_STATIC(foo_signed_rep::error, m.key_at(0));
+  EXPECT_EQ_STATIC(foo_signed_rep::seven, m.key_at(8));
+
+  auto keys = std::vector<foo_signed_rep>{};
+  auto sum = 0;
+  m.for_each([&](foo_signed_rep key, int value) {
+    keys.push_back(key);
+    sum += value;
+  });
+  EXPECT_EQ(9, keys.size());
+  EXPECT_TRUE(std::ranges::is_sorted(keys));
+  EXPECT_EQ(6, sum);
+  EXPECT_EQ(6, std::ranges::fold_left(m, 0, std::plus<>{}));
+}
+
+TEST(EnumMap, Empty)
+{
+  constexpr auto m = enum_map<empty, int>{};
+  EXPECT_EQ_STATIC(0, m.size());
+  EXPECT_EQ_STATIC(nullptr, m.find(static_cast<empty>(0)));
+}
@@ -332,3 +332,36 @@ TEST(TEST_SUITE_NAME, HashCollision)
   ASSERT_EQ_STATIC("/", enum_name(static_cast<hash_collision>(-1), "/"));
   ASSERT_EQ_STATIC("", enum_name(static_cast<hash_collision>(1 << 31), ""));
 }
+
+// Several dense blocks with isolated values in between
+enum class piecewise: int32_t {
+  n0 = -3, n1 = -2, n2 = -1, n3 = 0, n4 = 1,
+  isolated_a = 7,
+  a0 = 100, a1 = 101, a2 = 102, a3 = 103, a4 = 104, a5 = 105,
+  isolated_b = 500,
+  isolated_c = 502,
+  b0 = 1000, b1 = 1001, b2 = 1002, b3 = 1003,
+  c0 = 2000, c1 = 2001, c2 = 2002, c3 = 2003, c4 = 2004,
+};
+
+TEST(TEST_SUITE_NAME, Piecewise)
+{
+  ASSERT_EQ_STATIC("n0", enum_name(piecewise::n0));
+  ASSERT_EQ_STATIC("n4", enum_name(piecewise::n4));
+  ASSERT_EQ_STATIC("isolated_a", enum_name(piecewise::isolated_a));
+  ASSERT_EQ_STATIC("a0", enum_name(piecewise::a0));
+  ASSERT_EQ_STATIC("a5", enum_name(piecewise::a5));
+  ASSERT_EQ_STATIC("isolated_b", enum_name(piecewise::isolated_b));
+  ASSERT_EQ_STATIC("isolated_c", enum_name(piecewise::isolated_c));
+  ASSERT_EQ_STATIC("b2", enum_name(piecewise::b2));
+  ASSERT_EQ_STATIC("c0", enum_name(piecewise::c0));
+  ASSERT_EQ_STATIC("c4", enum_name(piecewise::c4));
+
+  for (auto v: {-4, 2, 6, 8, 99, 106, 501, 999, 1004, 1999, 2005}) {
+    EXPECT_EQ("<n/a>", enum_name(static_cast<piecewise>(v), "<n/a>"))
+      << "value = " << v;
+  }
+  for (auto [e, name]: reflect_cpp26::enum_entries<piecewise>()) {
+    EXPECT_EQ(name, enum_name(e));
+  }
+}
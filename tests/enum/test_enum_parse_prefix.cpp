@@ -0,0 +1,88 @@
+#include "tests/enum/enum_test_options.hpp"
+#include "tests/enum/test_cases.hpp"
+
+#ifdef ENABLE_FULL_HEADER_TEST
+#include <reflect_cpp26/enum.hpp>
+#else
+#include <reflect_cpp26/enum/enum_entries.hpp>
+#include <reflect_cpp26/enum/enum_parse_prefix.hpp>
+#endif
+
+using namespace reflect_cpp26;
+
+template <class E>
+constexpr auto parse_result(E value, size_t consumed)
+  -> std::pair<std::optional<E>, size_t>
+{
+  return {value, consumed};
+}
+
+template <class E>
+constexpr auto parse_failure() -> std::pair<std::optional<E>, size_t> {
+  return {std::nullopt, 0};
+}
+
+// Every name followed by any delimiter is parsed as itself.
+template <class E>
+void test_all_names_with_delimiter()
+{
+  for (auto [e, str]: enum_entries<E>()) {
+    for (auto delimiter: {"", " ", ",", ";rest"}) {
+      auto input = std::string{str} + delimiter;
+      EXPECT_EQ(parse_result(e, str.size()), enum_parse_prefix<E>(input))
+        << "input = '" << input << "'";
+    }
+  }
+}
+
+TEST(EnumParsePrefix, FooSigned)
+{
+  using E = foo_signed;
+  EXPECT_EQ_STATIC(parse_result(E::zero, 4), enum_parse_prefix<E>("zero"));
+  EXPECT_EQ_STATIC(parse_result(E::one, 3), enum_parse_prefix<E>("one two"));
+  EXPECT_EQ_STATIC(parse_result(E::error, 5), enum_parse_prefix<E>("errors"));
+  EXPECT_EQ_STATIC(parse_failure<E>(), enum_parse_prefix<E>(""));
+  EXPECT_EQ_STATIC(parse_failure<E>(), enum_parse_prefix<E>("ZERO"));
+  EXPECT_EQ_STATIC(parse_failure<E>(), enum_parse_prefix<E>(" zero"));
+  EXPECT_EQ_STATIC(parse_failure<E>(), enum_parse_prefix<E>("fou"));
+  test_all_names_with_delimiter<E>();
+}
+
+TEST(EnumParsePrefix, FooSignedRep)
+{
+  using E = foo_signed_rep;
+  EXPECT_EQ_STATIC(parse_result(E::one, 2), enum_parse_prefix<E>("yi,er"));
+  EXPECT_EQ_STATIC(parse_result(E::two, 2), enum_parse_prefix<E>("er"));
+  test_all_names_with_delimiter<E>();
+}
+
+TEST(EnumParsePrefix, Empty)
+{
+  EXPECT_EQ_STATIC(parse_failure<empty>(), enum_parse_prefix<empty>(""));
+  EXPECT_EQ_STATIC(parse_failure<empty>(), enum_parse_prefix<empty>("zero"));
+}
+
+TEST(EnumParsePrefix, Color)
+{
+  using E = color;
+  // Longest match
+  EXPECT_EQ_STATIC(parse_result(E::light_golden_rod_yellow, 23),
+    enum_parse_prefix<E>("light_golden_rod_yellow"));
+  EXPECT_EQ_STATIC(parse_result(E::green, 5),
+    enum_parse_prefix<E>("green_yell"));
+  EXPECT_EQ_STATIC(parse_result(E::green_yellow, 12),
+    enum_parse_prefix<E>("green_yellow_"));
+  EXPECT_EQ_STATIC(parse_result(E::red, 3), enum_parse_prefix<E>("reddish"));
+  EXPECT_EQ_STATIC(parse_failure<E>(), enum_parse_prefix<E>("light_"));
+  EXPECT_EQ_STATIC(parse_failure<E>(), enum_parse_prefix<E>("Red"));
+  test_all_names_with_delimiter<E>();
+}
+
+TEST(EnumParsePrefix, TerminalColor)
+{
+  using E = terminal_color;
+  EXPECT_EQ_STATIC(parse_result(E::bright_blue, 11),
+    enum_parse_prefix<E>("bright_blue bright_red"));
+  EXPECT_EQ_STATIC(parse_failure<E>(), enum_parse_prefix<E>("bright"));
+  test_all_names_with_delimiter<E>();
+}
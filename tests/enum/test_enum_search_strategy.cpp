@@ -0,0 +1,172 @@
+#include "tests/enum/enum_test_options.hpp"
+
+#ifdef ENABLE_FULL_HEADER_TEST
+#include <reflect_cpp26/annotations.hpp>
+#include <reflect_cpp26/enum.hpp>
+#else
+#include <reflect_cpp26/annotations/enum_properties.hpp>
+#include <reflect_cpp26/annotations/macros.h>
+#include <reflect_cpp26/enum/enum_cast.hpp>
+#include <reflect_cpp26/enum/enum_contains.hpp>
+#include <reflect_cpp26/enum/enum_index.hpp>
+#include <reflect_cpp26/enum/enum_names.hpp>
+#include <reflect_cpp26/enum/impl/enum_char_dispatch.hpp>
+#endif
+
+#define RFL_PROPERTY(...) REFLECT_CPP26_PROPERTY(__VA_ARGS__)
+
+using namespace reflect_cpp26;
+using value_search = annotations::enum_value_search_strategy;
+using name_search = annotations::enum_name_search_strategy;
+
+// Same values with different strategies
+#define SPARSE_ENTRIES \
+  a = -100, b = -7, c = 0, d = 1, e = 2, f = 3, g = 50, h = 1000,
+
+enum class sparse_auto: int32_t {
+  SPARSE_ENTRIES
+};
+
+enum class RFL_PROPERTY(enum_value_search, value_search::linear_search)
+  RFL_PROPERTY(enum_name_search, name_search::linear_search)
+sparse_linear: int32_t {
+  SPARSE_ENTRIES
+};
+
+enum class RFL_PROPERTY(enum_value_search, value_search::binary_search)
+  RFL_PROPERTY(enum_name_search, name_search::binary_search)
+sparse_binary: int32_t {
+  SPARSE_ENTRIES
+};
+
+enum class RFL_PROPERTY(enum_value_search, value_search::slot_table)
+  RFL_PROPERTY(enum_name_search, name_search::perfect_hash)
+sparse_slot: int32_t {
+  SPARSE_ENTRIES
+};
+
+enum class RFL_PROPERTY(enum_name_search, name_search::hash_table)
+  RFL_PROPERTY(enum_hash_min_load_factor, 0.5)
+  RFL_PROPERTY(enum_hash_seed, 42)
+sparse_hash: int32_t {
+  SPARSE_ENTRIES
+};
+
+#undef SPARSE_ENTRIES
+
+// Names of the same length: dispatched by characters within a single group
+enum class same_length {
+  cat, cow, dog, eel, emu, fox, gnu, hen, owl, pig, ram, yak,
+};
+
+template <class E>
+constexpr void test_sparse_common()
+{
+  ASSERT_EQ_STATIC("a", enum_name(E::a));
+  ASSERT_EQ_STATIC("d", enum_name(E::d));
+  ASSERT_EQ_STATIC("h", enum_name(E::h));
+  ASSERT_EQ_STATIC("", enum_name(static_cast<E>(4)));
+  ASSERT_EQ_STATIC("", enum_name(static_cast<E>(-101)));
+  ASSERT_EQ_STATIC("", enum_name(static_cast<E>(1001)));
+
+  ASSERT_EQ_STATIC(6, enum_index(E::g));
+  ASSERT_EQ_STATIC(npos, enum_index(static_cast<E>(-1)));
+  ASSERT_TRUE_STATIC(enum_contains(E::b));
+  ASSERT_FALSE_STATIC(enum_contains(static_cast<E>(49)));
+
+  ASSERT_EQ_STATIC(E::a, enum_cast<E>("a"));
+  ASSERT_EQ_STATIC(E::e, enum_cast<E>("e"));
+  ASSERT_EQ_STATIC(E::h, enum_cast<E>("h"));
+  ASSERT_EQ_STATIC(std::nullopt, enum_cast<E>("i"));
+  ASSERT_EQ_STATIC(std::nullopt, enum_cast<E>("aa"));
+  ASSERT_EQ_STATIC(std::nullopt, enum_cast<E>(""));
+}
+
+TEST(EnumSearchStrategy, Properties)
+{
+  using namespace annotations;
+  EXPECT_EQ_STATIC(value_search::automatic,
+    enum_value_search_of<sparse_auto>());
+  EXPECT_EQ_STATIC(name_search::automatic, enum_name_search_of<sparse_auto>());
+  EXPECT_EQ_STATIC(std::nullopt, enum_hash_seed_of<sparse_auto>());
+
+  EXPECT_EQ_STATIC(value_search::slot_table,
+    enum_value_search_of<sparse_slot>());
+  EXPECT_EQ_STATIC(name_search::perfect_hash,
+    enum_name_search_of<sparse_slot>());
+  EXPECT_EQ_STATIC(0.5, enum_hash_min_load_factor_of<sparse_hash>());
+  EXPECT_EQ_STATIC(42, enum_hash_seed_of<sparse_hash>());
+}
+
+TEST(EnumSearchStrategy, ValueTables)
+{
+  constexpr const auto& tb_auto = impl::enum_value_entry_table_v<sparse_auto>;
+  EXPECT_EQ_STATIC(1, tb_auto.runs.size());
+  EXPECT_TRUE_STATIC(tb_auto.slots.empty());
+
+  // Keys only
+  constexpr const auto& tb_linear =
+    impl::enum_value_entry_table_v<sparse_linear>;
+  EXPECT_EQ_STATIC(8, tb_linear.keys.size());
+  EXPECT_TRUE_STATIC(tb_linear.eytzinger.keys.empty());
+  EXPECT_TRUE_STATIC(tb_linear.runs.empty());
+  EXPECT_TRUE_STATIC(tb_linear.slots.empty());
+
+  constexpr const auto& tb_binary =
+    impl::enum_value_entry_table_v<sparse_binary>;
+  EXPECT_EQ_STATIC(9, tb_binary.eytzinger.keys.size()); // Node 0 is unused
+  EXPECT_TRUE_STATIC(tb_binary.runs.empty());
+  EXPECT_TRUE_STATIC(tb_binary.slots.empty());
+
+  // Slot table regardless of value span [-100, 1000]
+  constexpr const auto& tb_slot = impl::enum_value_entry_table_v<sparse_slot>;
+  EXPECT_EQ_STATIC(1101, tb_slot.slots.size());
+  EXPECT_TRUE_STATIC(tb_slot.eytzinger.keys.empty());
+}
+
+TEST(EnumSearchStrategy, HashTables)
+{
+  EXPECT_FALSE_STATIC(
+    impl::enum_hash_uses_char_dispatch_v<sparse_linear, false>);
+  EXPECT_FALSE_STATIC(impl::enum_hash_uses_table_lookup_v<sparse_binary>);
+  EXPECT_TRUE_STATIC(impl::enum_hash_uses_perfect_hash_v<sparse_slot>);
+  EXPECT_TRUE_STATIC(impl::enum_hash_uses_table_lookup_v<sparse_hash>);
+  EXPECT_FALSE_STATIC(impl::enum_hash_uses_perfect_hash_v<sparse_hash>);
+
+  // Load factor >= 0.5
+  constexpr auto hash_table = impl::enum_hash_entry_sparse_list_v<
+    sparse_hash, impl::enum_constants::hash_policy>;
+  EXPECT_TRUE_STATIC(hash_table.size() <= 16);
+  EXPECT_EQ_STATIC(42,
+    (impl::enum_hash_seed_v<sparse_hash, wordwise_hash_policy>));
+  EXPECT_EQ_STATIC(sparse_hash::f,
+    (enum_cast<sparse_hash, wordwise_hash_policy>("f")));
+}
+
+TEST(EnumSearchStrategy, Search)
+{
+  test_sparse_common<sparse_auto>();
+  test_sparse_common<sparse_linear>();
+  test_sparse_common<sparse_binary>();
+  test_sparse_common<sparse_slot>();
+  test_sparse_common<sparse_hash>();
+}
+
+TEST(EnumSearchStrategy, CharDispatch)
+{
+  constexpr const auto& groups =
+    impl::enum_char_dispatch_groups_v<same_length>;
+  EXPECT_EQ_STATIC(1, groups.size());
+  EXPECT_EQ_STATIC(12, groups[0].entries.size());
+  // Sorted for binary search by key
+  EXPECT_TRUE_STATIC(std::ranges::is_sorted(groups[0].keys));
+
+  for (auto name: enum_names<same_length>()) {
+    const auto* entry = impl::enum_char_dispatch_search<same_length>(name);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_TRUE(entry->name == name);
+  }
+  EXPECT_EQ(nullptr, impl::enum_char_dispatch_search<same_length>("cog"));
+  EXPECT_EQ(nullptr, impl::enum_char_dispatch_search<same_length>("zzz"));
+  EXPECT_EQ(nullptr, impl::enum_char_dispatch_search<same_length>("ca"));
+}
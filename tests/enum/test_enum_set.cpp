@@ -0,0 +1,65 @@
+#include "tests/enum/enum_test_options.hpp"
+#include "tests/enum/test_cases.hpp"
+
+#ifdef ENABLE_FULL_HEADER_TEST
+#include <reflect_cpp26/enum.hpp>
+#else
+#include <reflect_cpp26/enum/enum_names.hpp>
+#include <reflect_cpp26/enum/enum_set.hpp>
+#include <reflect_cpp26/enum/enum_values.hpp>
+#endif
+
+using namespace reflect_cpp26;
+
+TEST(EnumSet, Basic)
+{
+  using set_t = enum_set<foo_signed>;
+  constexpr auto s = set_t{foo_signed::zero, foo_signed::seven,
+                           foo_signed::error};
+  EXPECT_EQ_STATIC(3, s.size());
+  EXPECT_FALSE_STATIC(s.empty());
+  EXPECT_TRUE_STATIC(s.contains(foo_signed::seven));
+  EXPECT_FALSE_STATIC(s.contains(foo_signed::one));
+  EXPECT_FALSE_STATIC(s.contains(static_cast<foo_signed>(3)));
+
+  auto t = s;
+  t.erase(foo_signed::zero);
+  t.insert(foo_signed::one);
+  t.insert(foo_signed::one);
+  EXPECT_EQ(3, t.size());
+  EXPECT_EQ((set_t{foo_signed::error, foo_signed::one, foo_signed::seven}), t);
+
+  EXPECT_EQ(4, (s | t).size());
+  EXPECT_EQ((set_t{foo_signed::error, foo_signed::seven}), s & t);
+  EXPECT_EQ((set_t{foo_signed::zero}), s - t);
+  EXPECT_EQ((set_t{foo_signed::zero, foo_signed::one}), s ^ t);
+
+  t.clear();
+  EXPECT_TRUE(t.empty());
+  EXPECT_EQ(set_t{}, t);
+}
+
+TEST(EnumSet, All)
+{
+  EXPECT_EQ_STATIC(9, enum_set<foo_signed_rep>::all().size());
+  EXPECT_EQ_STATIC(0, enum_set<empty>::all().size());
+  EXPECT_EQ_STATIC(enum_unique_count<color>(), enum_set<color>::all().size());
+  EXPECT_EQ_STATIC(3, enum_set<color>::word_count);
+
+  auto all = enum_set<color>::all();
+  for (auto e: enum_values<color>()) {
+    EXPECT_TRUE(all.contains(e)) << enum_name(e);
+  }
+  EXPECT_FALSE(all.contains(static_cast<color>(0x123456)));
+}
+
+TEST(EnumSet, ForEach)
+{
+  auto s = enum_set<color>{color::white, color::black, color::red,
+                           color::alice_blue};
+  auto keys = std::vector<color>{};
+  s.for_each([&keys](color key) { keys.push_back(key); });
+  // Ascending order of values
+  EXPECT_EQ((std::vector{color::black, color::alice_blue, color::red,
+                         color::white}), keys);
+}
@@ -4,12 +4,22 @@
 #ifdef ENABLE_FULL_HEADER_TEST
 #include <reflect_cpp26/enum.hpp>
 #else
+#include <reflect_cpp26/enum/enum_names.hpp>
 #include <reflect_cpp26/enum/enum_switch.hpp>
+#include <reflect_cpp26/enum/enum_values.hpp>
 #endif
 
 using namespace reflect_cpp26;
 using namespace std::literals;
 
+#ifdef ENABLE_SWITCH_JUMP_TABLE_CHECK
+#define TEST_SUITE_NAME EnumSwitchJumpTable
+#endif
+
+#ifndef TEST_SUITE_NAME
+#define TEST_SUITE_NAME EnumSwitch
+#endif
+
 template <class E, unsigned p>
 struct underlying_pow_t {
   static constexpr auto operator()(E value)
@@ -23,7 +33,7 @@ struct underlying_pow_t {
   }
 };
 
-TEST(EnumSwitch, Basic)
+TEST(TEST_SUITE_NAME, Basic)
 {
   constexpr auto pos_res_1 = enum_switch<int>(
     underlying_pow_t<foo_signed, 2>{}, foo_signed::four);
@@ -72,7 +82,7 @@ enum class integer_indices {
   index_long = 4,
 };
 
-TEST(EnumSwitch, ToCommon)
+TEST(TEST_SUITE_NAME, ToCommon)
 {
   constexpr auto get_res_1 = enum_switch_to_common(
     get_from_constant_tuple_t{},
@@ -155,7 +165,7 @@ enum class array_index {
   three = 3,
 };
 
-TEST(EnumSwitch, Dereference)
+TEST(TEST_SUITE_NAME, Dereference)
 {
   auto array = std::array{"abc"s, "def"s, "ghi"s, "jkl"s};
   auto default_str = "<n/a>"s;
@@ -178,3 +188,52 @@ TEST(EnumSwitch, Dereference)
   EXPECT_EQ("<n/a><changed>", str2);
   EXPECT_EQ("<n/a>", default_str);
 }
+
+struct color_red_t {
+  static constexpr auto operator()(auto ec) -> int {
+    return (std::to_underlying(ec.value) >> 16) & 0xFF;
+  }
+};
+
+TEST(TEST_SUITE_NAME, ManyCases)
+{
+  // More than 64 cases
+  EXPECT_EQ_STATIC(0xF0, enum_switch<int>(color_red_t{}, color::alice_blue));
+  EXPECT_EQ_STATIC(0x66,
+    enum_switch<int>(color_red_t{}, color::rebecca_purple));
+  EXPECT_EQ_STATIC(0xFF, enum_switch(color_red_t{}, color::white, -1));
+  EXPECT_EQ_STATIC(-1,
+    enum_switch(color_red_t{}, static_cast<color>(0x123456), -1));
+
+  for (auto e: enum_values<color>()) {
+    auto expected = (std::to_underlying(e) >> 16) & 0xFF;
+    EXPECT_EQ(expected, enum_switch<int>(color_red_t{}, e)) << enum_name(e);
+    auto visited = 0zU;
+    enum_switch([&visited, e](auto ec) {
+      visited += (ec.value == e);
+    }, e);
+    EXPECT_EQ(1, visited) << enum_name(e);
+  }
+}
+
+// Dense values are dispatched without table search
+enum class dense_signed : int8_t {
+  m2 = -2, m1, zero, p1, p2, p2_alias = 2,
+};
+
+TEST(TEST_SUITE_NAME, DenseValues)
+{
+  EXPECT_TRUE_STATIC(impl::enum_switch_values_are_dense_v<dense_signed>);
+  EXPECT_FALSE_STATIC(impl::enum_switch_values_are_dense_v<color>);
+  EXPECT_FALSE_STATIC(impl::enum_switch_values_are_dense_v<empty>);
+
+  auto to_int = underlying_pow_t<dense_signed, 1>{};
+  for (auto i = -128; i < 128; i++) {
+    auto e = static_cast<dense_signed>(i);
+    auto expected = (-2 <= i && i <= 2) ? std::optional{i} : std::nullopt;
+    EXPECT_EQ(expected, enum_switch<int>(to_int, e)) << i;
+  }
+  EXPECT_EQ_STATIC(-2, enum_switch<int>(to_int, dense_signed::m2));
+  EXPECT_EQ_STATIC(2, enum_switch<int>(to_int, dense_signed::p2_alias));
+  EXPECT_EQ_STATIC(-1, enum_switch(to_int, static_cast<dense_signed>(3), -1));
+}
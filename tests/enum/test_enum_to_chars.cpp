@@ -0,0 +1,83 @@
+#include "tests/enum/enum_test_options.hpp"
+#include "tests/enum/test_cases.hpp"
+#include <iterator>
+
+#ifdef ENABLE_FULL_HEADER_TEST
+#include <reflect_cpp26/enum.hpp>
+#else
+#include <reflect_cpp26/enum/enum_to_chars.hpp>
+#endif
+
+using namespace reflect_cpp26;
+
+enum class level: int8_t {
+  debug = -1,
+  info = 0,
+  a_very_long_warning_name = 1,
+};
+
+enum class code: uint64_t {
+  ok = 0,
+};
+
+template <class E>
+constexpr auto to_chars_string(E value, size_t buffer_size) -> std::string
+{
+  auto buffer = std::string(buffer_size, '\0');
+  auto [ptr, ec] = enum_to_chars(
+    buffer.data(), buffer.data() + buffer_size, value);
+  if (std::errc{} != ec) {
+    return "<error>";
+  }
+  buffer.resize(ptr - buffer.data());
+  return buffer;
+}
+
+template <class E>
+constexpr auto to_chars_string(E value) -> std::string {
+  return to_chars_string(value, enum_to_chars_max_size<E>());
+}
+
+TEST(EnumToChars, MaxSize)
+{
+  // "a_very_long_warning_name" v.s. "(level)-128"
+  EXPECT_EQ_STATIC(24, enum_to_chars_max_size<level>());
+  // "(code)18446744073709551615" where max_decimal_digits(8) == 20
+  EXPECT_EQ_STATIC(26, enum_to_chars_max_size<code>());
+  // "(empty)" + max_decimal_digits(4) == 11
+  EXPECT_EQ_STATIC(18, enum_to_chars_max_size<const empty>());
+}
+
+TEST(EnumToChars, Pointer)
+{
+  EXPECT_EQ_STATIC("debug", to_chars_string(level::debug));
+  EXPECT_EQ_STATIC("a_very_long_warning_name",
+    to_chars_string(level::a_very_long_warning_name));
+  EXPECT_EQ_STATIC("(level)-128", to_chars_string(static_cast<level>(-128)));
+  EXPECT_EQ_STATIC("(level)127", to_chars_string(static_cast<level>(127)));
+  EXPECT_EQ_STATIC("ok", to_chars_string(code::ok));
+  EXPECT_EQ_STATIC("(code)18446744073709551615",
+    to_chars_string(static_cast<code>(-1)));
+  EXPECT_EQ_STATIC("(empty)0", to_chars_string(empty{}));
+  EXPECT_EQ_STATIC("(color)1", to_chars_string(static_cast<color>(1)));
+
+  // Buffer smaller than max size
+  EXPECT_EQ_STATIC("info", to_chars_string(level::info, 4));
+  EXPECT_EQ_STATIC("<error>", to_chars_string(level::info, 3));
+  EXPECT_EQ_STATIC("(level)2", to_chars_string(static_cast<level>(2), 8));
+  EXPECT_EQ_STATIC("<error>", to_chars_string(static_cast<level>(2), 7));
+  EXPECT_EQ_STATIC("<error>", to_chars_string(code::ok, 0));
+}
+
+TEST(EnumToChars, OutputIterator)
+{
+  auto res = std::string{};
+  enum_to_chars(std::back_inserter(res), level::debug);
+  res += ',';
+  enum_to_chars(std::back_inserter(res), static_cast<level>(-2));
+  EXPECT_EQ("debug,(level)-2", res);
+
+  char buffer[32] = {};
+  auto* tail = enum_to_chars(buffer, color::red);
+  EXPECT_EQ("red", std::string_view(buffer, tail));
+}
@@ -0,0 +1,241 @@
+#include "tests/test_options.hpp"
+#include <array>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#ifdef ENABLE_FULL_HEADER_TEST
+#include <reflect_cpp26/type_operations.hpp>
+#else
+#include <reflect_cpp26/type_operations/binary_serialization.hpp>
+#endif
+
+namespace rfl = reflect_cpp26;
+
+enum class side : uint8_t {
+  buy, sell,
+};
+
+struct point_t {
+  int32_t x;
+  int32_t y;
+};
+
+// Flat: encoded with a single memcpy
+struct quote_t {
+  int64_t timestamp;
+  double price;
+  point_t position;
+  int32_t volume;
+  side direction;
+  uint8_t venue;
+  uint16_t flags;
+};
+
+struct padded_t {
+  uint8_t tag;  // Run #1
+  int32_t x;    // Run #2 (after 3 bytes of padding)
+  double y;
+};
+
+struct base_t {
+  int32_t id;
+};
+
+struct order_t : base_t {
+  int32_t account;              // Run #1 with id
+  std::string symbol;           // Memberwise
+  std::vector<point_t> legs;    // Memberwise (elements in bulk)
+  std::optional<double> limit;  // Memberwise
+  int64_t quantity;             // Run #2
+  std::tuple<int8_t, std::string> note;
+  uint8_t urgent : 1;
+  uint8_t level : 3;
+};
+
+struct renamed_point_t {
+  int32_t lhs;
+  int32_t rhs;
+};
+
+struct pointer_t {
+  int* ptr;
+};
+
+struct empty_t {};
+
+TEST(TypeOperationsBinarySerialization, Concept)
+{
+  EXPECT_TRUE_STATIC(rfl::is_binary_packed_v<quote_t>);
+  EXPECT_TRUE_STATIC(rfl::is_binary_packed_v<point_t[4]>);
+  EXPECT_TRUE_STATIC(rfl::is_binary_packed_v<std::array<point_t, 4>>);
+  EXPECT_FALSE_STATIC(rfl::is_binary_packed_v<padded_t>);
+  EXPECT_FALSE_STATIC(rfl::is_binary_packed_v<order_t>);
+  EXPECT_FALSE_STATIC(rfl::is_binary_packed_v<const int>);
+  EXPECT_TRUE_STATIC(rfl::is_binary_packed_v<bool>);
+  EXPECT_TRUE_STATIC(rfl::is_binary_packed_v<double>);
+  if constexpr (std::numeric_limits<long double>::digits == 64) {
+    // x87 80-bit long double has padding bytes
+    EXPECT_FALSE_STATIC(rfl::is_binary_packed_v<long double>);
+    EXPECT_FALSE_STATIC(rfl::binary_serializable<long double>);
+  }
+
+  EXPECT_TRUE_STATIC(rfl::binary_serializable<std::string>);
+  EXPECT_TRUE_STATIC(rfl::binary_serializable<std::u16string>);
+  EXPECT_TRUE_STATIC(rfl::binary_serializable<const order_t>);
+  EXPECT_TRUE_STATIC(rfl::binary_serializable<std::vector<std::string>>);
+  EXPECT_FALSE_STATIC(rfl::binary_serializable<int*>);
+  EXPECT_FALSE_STATIC(rfl::binary_serializable<pointer_t>);
+  EXPECT_FALSE_STATIC(rfl::binary_serializable<std::vector<pointer_t>>);
+
+  // Elements encoded as 0 bytes can not be counted by the input size
+  EXPECT_TRUE_STATIC(rfl::binary_serializable<empty_t>);
+  EXPECT_TRUE_STATIC(rfl::binary_serializable<std::tuple<>>);
+  EXPECT_FALSE_STATIC(rfl::binary_serializable<std::vector<empty_t>>);
+  EXPECT_FALSE_STATIC(rfl::binary_serializable<std::vector<std::tuple<>>>);
+}
+
+TEST(TypeOperationsBinarySerialization, Fingerprint)
+{
+  constexpr auto header_size = sizeof(uint64_t);
+  auto data = rfl::to_binary(point_t{1, 2});
+  EXPECT_EQ(header_size + sizeof(point_t), data.size());
+  auto fingerprint = uint64_t{};
+  std::memcpy(&fingerprint, data.data(), header_size);
+  EXPECT_EQ(rfl::binary_layout_fingerprint_v<point_t>, fingerprint);
+
+  // Renaming members does not change layout
+  EXPECT_EQ_STATIC(rfl::binary_layout_fingerprint_v<point_t>,
+                   rfl::binary_layout_fingerprint_v<renamed_point_t>);
+  EXPECT_NE_STATIC(rfl::binary_layout_fingerprint_v<point_t>,
+                   rfl::binary_layout_fingerprint_v<int64_t>);
+  EXPECT_NE_STATIC(rfl::binary_layout_fingerprint_v<point_t>,
+                   rfl::binary_layout_fingerprint_v<std::array<int32_t, 2>>);
+  EXPECT_NE_STATIC(rfl::binary_layout_fingerprint_v<std::vector<int32_t>>,
+                   rfl::binary_layout_fingerprint_v<std::vector<uint32_t>>);
+
+  auto value = int64_t{};
+  auto res = rfl::from_binary(data.data(), data.data() + data.size(), value);
+  EXPECT_EQ(std::errc::protocol_error, res.ec);
+  EXPECT_EQ(data.data(), res.ptr);
+}
+
+TEST(TypeOperationsBinarySerialization, BulkRuns)
+{
+  constexpr auto header_size = sizeof(uint64_t);
+  auto quote = quote_t{
+    .timestamp = 1700000000, .price = 12.5, .position = {3, 4},
+    .volume = 100, .direction = side::sell, .venue = 7, .flags = 0x1234};
+  auto data = rfl::to_binary(quote);
+  EXPECT_EQ(header_size + sizeof(quote_t), data.size());
+  auto quote_parsed = rfl::from_binary<quote_t>(data);
+  ASSERT_TRUE(quote_parsed.has_value());
+  EXPECT_EQ(0, std::memcmp(&quote, &*quote_parsed, sizeof(quote_t)));
+
+  // Padding bytes are skipped
+  auto padded = padded_t{.tag = 1, .x = 2, .y = 3.5};
+  data = rfl::to_binary(padded);
+  EXPECT_EQ(header_size + 1 + 4 + 8, data.size());
+  auto padded_parsed = rfl::from_binary<padded_t>(data);
+  ASSERT_TRUE(padded_parsed.has_value());
+  EXPECT_EQ(1, padded_parsed->tag);
+  EXPECT_EQ(2, padded_parsed->x);
+  EXPECT_EQ(3.5, padded_parsed->y);
+
+  // Contiguous ranges of packed elements are copied in bulk as well
+  auto points = std::vector<point_t>{{1, 2}, {3, 4}, {5, 6}};
+  data = rfl::to_binary(points);
+  EXPECT_EQ(header_size + sizeof(uint64_t) + 3 * sizeof(point_t),
+            data.size());
+  auto points_parsed = rfl::from_binary<std::vector<point_t>>(data);
+  ASSERT_TRUE(points_parsed.has_value());
+  EXPECT_EQ(3, points_parsed->size());
+  EXPECT_EQ(6, points_parsed->back().y);
+}
+
+TEST(TypeOperationsBinarySerialization, Memberwise)
+{
+  auto order = order_t{};
+  order.id = 42;
+  order.account = -1;
+  order.symbol = "ABC";
+  order.legs = {{1, 2}, {3, 4}};
+  order.quantity = 1'000'000;
+  order.note = {'n', "note"};
+  order.urgent = 1;
+  order.level = 5;
+
+  auto data = rfl::to_binary(order);
+  auto parsed = rfl::from_binary<order_t>(data);
+  ASSERT_TRUE(parsed.has_value());
+  EXPECT_EQ(42, parsed->id);
+  EXPECT_EQ(-1, parsed->account);
+  EXPECT_EQ("ABC", parsed->symbol);
+  EXPECT_EQ(2, parsed->legs.size());
+  EXPECT_EQ(4, parsed->legs[1].y);
+  EXPECT_EQ(std::nullopt, parsed->limit);
+  EXPECT_EQ(1'000'000, parsed->quantity);
+  EXPECT_EQ("note", std::get<1>(parsed->note));
+  EXPECT_EQ(1, parsed->urgent);
+  EXPECT_EQ(5, parsed->level);
+
+  order.limit = 9.75;
+  parsed = rfl::from_binary<order_t>(rfl::to_binary(order));
+  ASSERT_TRUE(parsed.has_value());
+  EXPECT_EQ(9.75, parsed->limit);
+}
+
+TEST(TypeOperationsBinarySerialization, Append)
+{
+  auto buffer = std::string{};
+  rfl::append_binary(buffer, point_t{1, 2});
+  rfl::append_binary(buffer, std::string{"xyz"});
+
+  const auto* first = buffer.data();
+  const auto* last = buffer.data() + buffer.size();
+  auto point = point_t{};
+  auto res = rfl::from_binary(first, last, point);
+  EXPECT_EQ(std::errc{}, res.ec);
+  EXPECT_EQ(2, point.y);
+
+  auto str = std::string{};
+  res = rfl::from_binary(res.ptr, last, str);
+  EXPECT_EQ(std::errc{}, res.ec);
+  EXPECT_EQ(last, res.ptr);
+  EXPECT_EQ("xyz", str);
+}
+
+TEST(TypeOperationsBinarySerialization, InvalidInput)
+{
+  auto data = rfl::to_binary(std::vector<int32_t>{1, 2, 3});
+  // Truncated
+  auto truncated = std::string_view{data}.substr(0, data.size() - 1);
+  EXPECT_EQ(std::nullopt, rfl::from_binary<std::vector<int32_t>>(truncated));
+  // Trailing bytes
+  EXPECT_EQ(std::nullopt, rfl::from_binary<std::vector<int32_t>>(data + '\0'));
+
+  // Size beyond input is rejected before allocation
+  auto size = uint64_t{1} << 60;
+  std::memcpy(data.data() + sizeof(uint64_t), &size, sizeof(size));
+  auto values = std::vector<int32_t>{};
+  auto res = rfl::from_binary(data.data(), data.data() + data.size(), values);
+  EXPECT_EQ(std::errc::invalid_argument, res.ec);
+  EXPECT_EQ(data.data() + sizeof(uint64_t), res.ptr);
+
+  // Likewise for elements encoded memberwise
+  data = rfl::to_binary(std::vector<std::string>{"a"});
+  size = uint64_t{1} << 62;
+  std::memcpy(data.data() + sizeof(uint64_t), &size, sizeof(size));
+  auto strings = std::vector<std::string>{};
+  res = rfl::from_binary(data.data(), data.data() + data.size(), strings);
+  EXPECT_EQ(std::errc::invalid_argument, res.ec);
+  EXPECT_EQ(data.data() + sizeof(uint64_t), res.ptr);
+
+  // Invalid flag of std::optional
+  data = rfl::to_binary(std::optional<int32_t>{});
+  data.back() = 2;
+  EXPECT_EQ(std::nullopt, rfl::from_binary<std::optional<int32_t>>(data));
+}
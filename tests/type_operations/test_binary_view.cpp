@@ -0,0 +1,166 @@
+#include "tests/test_options.hpp"
+#include <cstddef>
+#include <span>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#ifdef ENABLE_FULL_HEADER_TEST
+#include <reflect_cpp26/type_operations.hpp>
+#else
+#include <reflect_cpp26/type_operations/binary_view.hpp>
+#endif
+
+namespace rfl = reflect_cpp26;
+
+enum class side : uint8_t {
+  buy, sell,
+};
+
+struct point_t {
+  int32_t x;
+  int32_t y;
+};
+
+// Packed: view members load from the same offsets as in quote_t
+struct quote_t {
+  int64_t timestamp;
+  double price;
+  point_t position;
+  int32_t volume;
+  side direction;
+  uint8_t venue;
+  uint16_t flags;
+};
+
+// Not packed: 3 bytes of padding after tag are removed by encoding
+struct padded_t {
+  uint8_t tag;
+  int32_t x;
+  double y;
+};
+
+struct header_t {
+  uint16_t version;
+};
+
+struct record_t : header_t {
+  padded_t inner;  // Nested view
+  std::tuple<int8_t, int32_t> pair;
+  side direction;
+  uint8_t level : 3;
+};
+
+// Serializable, but the encoded size varies with name
+struct not_viewable_t {
+  int32_t id;
+  std::string name;
+};
+
+TEST(TypeOperationsBinaryView, Concept)
+{
+  EXPECT_TRUE_STATIC(rfl::binary_viewable<quote_t>);
+  EXPECT_TRUE_STATIC(rfl::binary_viewable<const record_t>);
+  EXPECT_FALSE_STATIC(rfl::binary_viewable<int32_t>);
+  EXPECT_TRUE_STATIC(rfl::binary_serializable<not_viewable_t>);
+  EXPECT_FALSE_STATIC(rfl::binary_viewable<not_viewable_t>);
+  EXPECT_FALSE_STATIC(rfl::binary_viewable<std::vector<point_t>>);
+
+  EXPECT_EQ_STATIC(sizeof(quote_t), rfl::binary_view_size_v<quote_t>);
+  EXPECT_EQ_STATIC(13, rfl::binary_view_size_v<padded_t>);
+  EXPECT_EQ_STATIC(2 + 13 + 5 + 1 + 1, rfl::binary_view_size_v<record_t>);
+}
+
+TEST(TypeOperationsBinaryView, MemberTypes)
+{
+  using quote_view_t = rfl::view_of<quote_t>;
+  EXPECT_TRUE_STATIC(std::is_same_v<rfl::binary_value_view<int64_t, 0>,
+                                    decltype(quote_view_t::timestamp)>);
+  EXPECT_TRUE_STATIC(std::is_same_v<rfl::binary_value_view<point_t, 16>,
+                                    decltype(quote_view_t::position)>);
+  EXPECT_TRUE_STATIC(std::is_same_v<rfl::binary_value_view<uint16_t, 30>,
+                                    decltype(quote_view_t::flags)>);
+
+  using record_view_t = rfl::view_of<record_t>;
+  EXPECT_TRUE_STATIC(std::is_same_v<rfl::binary_value_view<uint16_t, 0>,
+                                    decltype(record_view_t::version)>);
+  EXPECT_TRUE_STATIC(std::is_same_v<rfl::view_of<padded_t>,
+                                    decltype(record_view_t::inner)>);
+  EXPECT_TRUE_STATIC(std::is_same_v<rfl::binary_value_view<double, 5>,
+                                    decltype(rfl::view_of<padded_t>::y)>);
+  EXPECT_TRUE_STATIC(std::is_same_v<rfl::binary_value_view<side, 20>,
+                                    decltype(record_view_t::direction)>);
+  EXPECT_TRUE_STATIC(std::is_same_v<rfl::binary_value_view<uint8_t, 21>,
+                                    decltype(record_view_t::level)>);
+}
+
+TEST(TypeOperationsBinaryView, ViewMessage)
+{
+  auto quote = quote_t{
+    .timestamp = 1700000000, .price = 12.5, .position = {3, 4},
+    .volume = 100, .direction = side::sell, .venue = 7, .flags = 0x1234};
+  auto data = rfl::to_binary(quote);
+  auto view = rfl::view_binary<quote_t>(data);
+  ASSERT_TRUE(view.has_value());
+  EXPECT_EQ(1700000000, view->timestamp.get());
+  EXPECT_EQ(12.5, view->price.get());
+  EXPECT_EQ(4, view->position.get().y);
+  EXPECT_EQ(side::sell, view->direction.get());
+  EXPECT_EQ(0x1234, view->flags.get());
+  // Implicit conversion
+  double price = view->price;
+  EXPECT_EQ(12.5, price);
+
+  // Mismatched fingerprint or size
+  EXPECT_EQ(std::nullopt, rfl::view_binary<point_t>(data));
+  data.pop_back();
+  EXPECT_EQ(std::nullopt, rfl::view_binary<quote_t>(data));
+}
+
+TEST(TypeOperationsBinaryView, NestedView)
+{
+  auto record = record_t{};
+  record.version = 3;
+  record.inner = {.tag = 1, .x = -2, .y = 4.5};
+  record.pair = {-8, 1 << 20};
+  record.direction = side::buy;
+  record.level = 5;
+
+  auto view = rfl::view_binary<record_t>(rfl::to_binary(record));
+  ASSERT_TRUE(view.has_value());
+  EXPECT_EQ(3, view->version.get());
+  EXPECT_EQ(1, view->inner.tag.get());
+  EXPECT_EQ(-2, view->inner.x.get());
+  EXPECT_EQ(4.5, view->inner.y.get());
+  EXPECT_EQ(-8, std::get<0>(view->pair.get()));
+  EXPECT_EQ(1 << 20, std::get<1>(view->pair.get()));
+  EXPECT_EQ(side::buy, view->direction.get());
+  EXPECT_EQ(5, view->level.get());
+}
+
+TEST(TypeOperationsBinaryView, Records)
+{
+  auto records = std::vector<padded_t>{};
+  for (auto i = 0; i < 100; i++) {
+    records.push_back({
+      .tag = static_cast<uint8_t>(i), .x = i * i, .y = i * 0.5});
+  }
+  // Header, then size, then records without padding
+  auto data = rfl::to_binary(records);
+  constexpr auto stride = rfl::binary_view_size_v<padded_t>;
+  ASSERT_EQ(2 * sizeof(uint64_t) + records.size() * stride, data.size());
+
+  auto bytes = std::as_bytes(std::span{data}).subspan(2 * sizeof(uint64_t));
+  auto sum = int64_t{0};
+  for (auto i = 0zU; i < records.size(); i++) {
+    auto view = rfl::make_view<padded_t>(bytes.subspan(i * stride));
+    if (view.tag.get() % 2 == 0) {
+      sum += view.x.get();
+    }
+  }
+  auto expected = int64_t{0};
+  for (auto i = 0; i < 100; i += 2) {
+    expected += i * i;
+  }
+  EXPECT_EQ(expected, sum);
+}
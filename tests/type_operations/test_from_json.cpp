@@ -0,0 +1,204 @@
+#include "tests/test_options.hpp"
+#include <array>
+#include <cmath>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#ifdef ENABLE_FULL_HEADER_TEST
+#include <reflect_cpp26/annotations.hpp>
+#include <reflect_cpp26/type_operations.hpp>
+#else
+#include <reflect_cpp26/annotations/macros.h>
+#include <reflect_cpp26/type_operations/from_json.hpp>
+#include <reflect_cpp26/type_operations/to_json.hpp>
+#endif
+
+#define RFL_PROPERTY(...) REFLECT_CPP26_PROPERTY(__VA_ARGS__)
+
+namespace rfl = reflect_cpp26;
+
+enum class severity : uint8_t {
+  debug, info, warning, error,
+};
+
+struct point_t {
+  int32_t x;
+  int32_t y;
+};
+
+struct header_t {
+  RFL_PROPERTY(rename, "ts")
+  RFL_PROPERTY(aliases, {"time", "timestamp"})
+  int64_t timestamp;
+  severity level;
+};
+
+struct record_t : header_t {
+  RFL_PROPERTY(rename, "msg")
+  std::string message;
+  std::vector<point_t> path;
+  std::optional<uint32_t> code;
+  bool acked;
+};
+
+struct tagged_t {
+  char tag[4];
+  char initial;
+  std::tuple<int, double> pair;
+  uint8_t flags : 4;
+};
+
+struct empty_t {};
+
+struct const_member_t {
+  const int value;
+};
+
+TEST(TypeOperationsFromJson, Concept)
+{
+  EXPECT_TRUE_STATIC(rfl::json_deserializable<record_t>);
+  EXPECT_TRUE_STATIC(rfl::json_deserializable<std::array<point_t, 2>>);
+  EXPECT_TRUE_STATIC(rfl::json_deserializable<std::optional<empty_t>>);
+  EXPECT_FALSE_STATIC(rfl::json_deserializable<int*>);
+  EXPECT_FALSE_STATIC(rfl::json_deserializable<std::string_view>);
+  EXPECT_FALSE_STATIC(rfl::json_deserializable<const_member_t>);
+  EXPECT_FALSE_STATIC(
+    rfl::json_deserializable<std::vector<const_member_t>>);
+}
+
+TEST(TypeOperationsFromJson, Scalars)
+{
+  EXPECT_EQ_STATIC(true, rfl::from_json<bool>(" true "));
+  EXPECT_EQ_STATIC('c', rfl::from_json<char>("\"c\""));
+  EXPECT_EQ_STATIC(-128, rfl::from_json<int8_t>("-128"));
+  EXPECT_EQ_STATIC(std::nullopt, rfl::from_json<int8_t>("128"));
+  EXPECT_EQ_STATIC(std::nullopt, rfl::from_json<int>("12 3"));
+  EXPECT_EQ_STATIC(std::nullopt, rfl::from_json<int>("1.5"));
+  EXPECT_EQ_STATIC(severity::warning,
+    rfl::from_json<severity>("\"warning\""));
+  EXPECT_EQ_STATIC(severity::info, rfl::from_json<severity>("\"\\u0069nfo\""));
+  EXPECT_EQ_STATIC(static_cast<severity>(42), rfl::from_json<severity>("42"));
+  EXPECT_EQ_STATIC(std::nullopt, rfl::from_json<severity>("\"fatal\""));
+
+  EXPECT_EQ(0.1, rfl::from_json<double>("0.1"));
+  EXPECT_EQ(-2.5e3f, rfl::from_json<float>("-2.5e3"));
+  EXPECT_TRUE(std::isnan(rfl::from_json<double>("null").value()));
+}
+
+TEST(TypeOperationsFromJson, Strings)
+{
+  EXPECT_EQ_STATIC("a\"b\\c\n\t/",
+    rfl::from_json<std::string>(R"("a\"b\\c\n\t\/")"));
+  // \u escape sequences are decoded as UTF-8, including surrogate pairs
+  EXPECT_EQ_STATIC("\xce\xb2\xf0\x9f\x98\x80",
+    rfl::from_json<std::string>(R"("\u03b2\ud83d\ude00")"));
+  EXPECT_EQ_STATIC(std::nullopt, rfl::from_json<std::string>(R"("\ud83d")"));
+  EXPECT_EQ_STATIC(std::nullopt, rfl::from_json<std::string>("\"a\nb\""));
+  EXPECT_EQ_STATIC(std::nullopt, rfl::from_json<std::string>(R"("\x")"));
+  EXPECT_EQ_STATIC(std::nullopt, rfl::from_json<std::string>("\"abc"));
+
+  char buffer[4] = {'x', 'x', 'x', 'x'};
+  auto json = std::string_view{R"("ab")"};
+  auto res = rfl::from_json(json.data(), json.data() + json.size(), buffer);
+  EXPECT_EQ(std::errc{}, res.ec);
+  EXPECT_EQ(json.data() + json.size(), res.ptr);
+  EXPECT_THAT(buffer, testing::ElementsAre('a', 'b', '\0', '\0'));
+
+  json = R"("abcde")";
+  res = rfl::from_json(json.data(), json.data() + json.size(), buffer);
+  EXPECT_EQ(std::errc::value_too_large, res.ec);
+}
+
+TEST(TypeOperationsFromJson, Containers)
+{
+  EXPECT_EQ_STATIC(std::vector<int>{},
+    rfl::from_json<std::vector<int>>(" [ ] "));
+  EXPECT_EQ_STATIC((std::vector<int>{1, 2, 3}),
+    rfl::from_json<std::vector<int>>("[1, 2,3]"));
+  EXPECT_EQ_STATIC((std::array{1, 2}),
+    rfl::from_json<std::array<int, 2>>("[1,2]"));
+  EXPECT_EQ_STATIC(std::nullopt,
+    rfl::from_json<std::array<int, 2>>("[1,2,3]"));
+  EXPECT_EQ_STATIC((std::tuple{1, std::string{"x"}}),
+    (rfl::from_json<std::tuple<int, std::string>>(R"([1,"x"])")));
+  EXPECT_EQ_STATIC((std::vector<std::optional<int>>{1, std::nullopt}),
+    rfl::from_json<std::vector<std::optional<int>>>("[1,null]"));
+  EXPECT_EQ_STATIC(std::nullopt, rfl::from_json<std::vector<int>>("[1,]"));
+}
+
+TEST(TypeOperationsFromJson, Aggregates)
+{
+  EXPECT_TRUE_STATIC(rfl::from_json<empty_t>("{}").has_value());
+  // Unknown keys are skipped
+  EXPECT_TRUE_STATIC(rfl::from_json<empty_t>(
+    R"({"a":[1,{"b":null}],"c":"}"})").has_value());
+  EXPECT_EQ_STATIC(-2, rfl::from_json<point_t>(R"({"y":-2,"x":1})")->y);
+  EXPECT_EQ_STATIC(std::nullopt, rfl::from_json<point_t>(R"({"x":"1"})"));
+  EXPECT_EQ_STATIC(std::nullopt, rfl::from_json<point_t>(R"({"x":1,})"));
+
+  auto record = rfl::from_json<record_t>(R"({
+    "time": 1700000000, "level": "error", "msg": "disk \"sda\" full",
+    "path": [{"x": 0, "y": 0}, {"x": 3, "y": 4}], "code": 404,
+    "acked": false, "extra": [true, 1.5e-3]
+  })");
+  ASSERT_TRUE(record.has_value());
+  EXPECT_EQ(1700000000, record->timestamp);
+  EXPECT_EQ(severity::error, record->level);
+  EXPECT_EQ("disk \"sda\" full", record->message);
+  EXPECT_EQ(2, record->path.size());
+  EXPECT_EQ(4, record->path[1].y);
+  EXPECT_EQ(404, record->code);
+  EXPECT_FALSE(record->acked);
+
+  // Keys by identifier are replaced by rename_t
+  EXPECT_EQ(0, rfl::from_json<record_t>(R"({"message":"x"})")->message.size());
+  EXPECT_EQ(3, rfl::from_json<header_t>(R"({"ts":3})")->timestamp);
+  EXPECT_EQ(4, rfl::from_json<header_t>(R"({"timestamp":4})")->timestamp);
+
+  auto tagged = rfl::from_json<tagged_t>(
+    R"({"tag":"ab","initial":"z","pair":[1,0.5],"flags":9})");
+  ASSERT_TRUE(tagged.has_value());
+  EXPECT_STREQ("ab", tagged->tag);
+  EXPECT_EQ('z', tagged->initial);
+  EXPECT_EQ(0.5, std::get<1>(tagged->pair));
+  EXPECT_EQ(9, tagged->flags);
+
+  // Bit-field of 4 bits can not hold 20
+  auto json = std::string_view{R"({"flags": 20})"};
+  auto value = tagged_t{};
+  auto res = rfl::from_json(json.data(), json.data() + json.size(), value);
+  EXPECT_EQ(std::errc::result_out_of_range, res.ec);
+  EXPECT_EQ(json.data() + json.find("20"), res.ptr);
+  EXPECT_EQ(std::nullopt, rfl::from_json<tagged_t>(json));
+}
+
+TEST(TypeOperationsFromJson, RoundTrip)
+{
+  auto record = record_t{};
+  record.timestamp = -1;
+  record.level = severity::debug;
+  record.message = "\x01\xce\xb2";
+  record.path = {{1, 2}};
+  record.acked = true;
+  auto json = rfl::to_json(record);
+  auto parsed = rfl::from_json<record_t>(json);
+  ASSERT_TRUE(parsed.has_value());
+  EXPECT_EQ(json, rfl::to_json(*parsed));
+}
+
+TEST(TypeOperationsFromJson, PartialInput)
+{
+  auto json = std::string_view{R"({"x":1,"y":2} trailing)"};
+  auto value = point_t{};
+  auto res = rfl::from_json(json.data(), json.data() + json.size(), value);
+  EXPECT_EQ(std::errc{}, res.ec);
+  EXPECT_EQ(" trailing", std::string_view(res.ptr, json.data() + json.size()));
+  EXPECT_EQ(2, value.y);
+  EXPECT_EQ(std::nullopt, rfl::from_json<point_t>(json));
+
+  json = R"({"x":1,"y":99999999999})";
+  res = rfl::from_json(json.data(), json.data() + json.size(), value);
+  EXPECT_EQ(std::errc::result_out_of_range, res.ec);
+  EXPECT_EQ(json.data() + json.find("99"), res.ptr);
+}
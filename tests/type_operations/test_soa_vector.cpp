@@ -0,0 +1,209 @@
+#include "tests/test_options.hpp"
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#ifdef ENABLE_FULL_HEADER_TEST
+#include <reflect_cpp26/type_operations.hpp>
+#else
+#include <reflect_cpp26/type_operations/soa_vector.hpp>
+#endif
+
+namespace rfl = reflect_cpp26;
+
+struct base_t {
+  int64_t id;
+};
+
+struct particle_t : base_t {
+  float x;
+  float y;
+  bool alive;
+  std::string tag;
+};
+
+struct const_member_t {
+  const int value;
+};
+
+struct reference_member_t {
+  int& value;
+};
+
+// Copy assignment throws if armed. Move assignment is copy assignment.
+struct fragile_t {
+  static inline bool armed = false;
+  int value = 0;
+
+  auto operator=(const fragile_t& rhs) -> fragile_t&
+  {
+    if (armed) {
+      throw std::runtime_error("fragile_t");
+    }
+    value = rhs.value;
+    return *this;
+  }
+};
+
+struct guarded_t {
+  std::string tag;
+  fragile_t fragile;
+};
+
+auto make_particle(int i) -> particle_t
+{
+  auto res = particle_t{};
+  res.id = i;
+  res.x = i * 1.5f;
+  res.y = -i * 1.0f;
+  res.alive = (i % 3 != 0);
+  res.tag = "p" + std::to_string(i);
+  return res;
+}
+
+TEST(TypeOperationsSoaVector, Concept)
+{
+  EXPECT_TRUE_STATIC(rfl::soa_element<particle_t>);
+  EXPECT_FALSE_STATIC(rfl::soa_element<int>);
+  EXPECT_FALSE_STATIC(rfl::soa_element<const particle_t>);
+  EXPECT_FALSE_STATIC(rfl::soa_element<const_member_t>);
+  EXPECT_FALSE_STATIC(rfl::soa_element<reference_member_t>);
+}
+
+TEST(TypeOperationsSoaVector, Storage)
+{
+  using columns_t = rfl::soa_columns_of<particle_t>;
+  EXPECT_TRUE_STATIC(std::is_same_v<std::unique_ptr<int64_t[]>,
+                                    decltype(columns_t::id)>);
+  EXPECT_TRUE_STATIC(std::is_same_v<std::unique_ptr<float[]>,
+                                    decltype(columns_t::x)>);
+  EXPECT_TRUE_STATIC(std::is_same_v<std::unique_ptr<std::string[]>,
+                                    decltype(columns_t::tag)>);
+  EXPECT_EQ_STATIC(5, rfl::soa_vector<particle_t>::column_count);
+
+  using reference_t = rfl::soa_reference_of<particle_t>;
+  EXPECT_TRUE_STATIC(std::is_same_v<float&, decltype(reference_t::x)>);
+  using const_reference_t = rfl::soa_const_reference_of<particle_t>;
+  EXPECT_TRUE_STATIC(std::is_same_v<const bool&,
+                                    decltype(const_reference_t::alive)>);
+}
+
+TEST(TypeOperationsSoaVector, PushBackAndGet)
+{
+  auto particles = rfl::soa_vector<particle_t>{};
+  EXPECT_TRUE(particles.empty());
+  for (auto i = 0; i < 100; i++) {
+    particles.push_back(make_particle(i));
+  }
+  EXPECT_EQ(100, particles.size());
+  EXPECT_LE(100, particles.capacity());
+
+  auto p = particles.get(42);
+  EXPECT_EQ(42, p.id);
+  EXPECT_EQ(63.0f, p.x);
+  EXPECT_EQ(-42.0f, p.y);
+  EXPECT_FALSE(p.alive);
+  EXPECT_EQ("p42", p.tag);
+
+  particles.set(42, make_particle(7));
+  EXPECT_EQ("p7", particles.get(42).tag);
+  particles.pop_back();
+  EXPECT_EQ(99, particles.size());
+  EXPECT_EQ(98, particles.get(98).id);
+}
+
+TEST(TypeOperationsSoaVector, ProxyReference)
+{
+  auto particles = rfl::soa_vector<particle_t>{};
+  particles.push_back(make_particle(1));
+  particles.push_back(make_particle(2));
+
+  auto ref = particles[1];
+  ref.x = 10.0f;
+  ref.tag += "!";
+  EXPECT_EQ(10.0f, particles.get(1).x);
+  EXPECT_EQ("p2!", particles.get(1).tag);
+  EXPECT_EQ(1.5f, particles[0].x);
+
+  const auto& const_particles = particles;
+  EXPECT_EQ(2, const_particles[1].id);
+  EXPECT_EQ("p1", const_particles[0].tag);
+}
+
+TEST(TypeOperationsSoaVector, Column)
+{
+  auto particles = rfl::soa_vector<particle_t>{};
+  particles.resize(10);
+  auto ids = particles.column<&particle_t::id>();  // Inherited from base_t
+  EXPECT_TRUE_STATIC(std::is_same_v<std::span<int64_t>, decltype(ids)>);
+  EXPECT_EQ(10, ids.size());
+  EXPECT_EQ(0, ids[9]);
+  std::iota(ids.begin(), ids.end(), int64_t{100});
+
+  auto xs = particles.column<&particle_t::x>();
+  std::ranges::fill(xs, 2.0f);
+  EXPECT_EQ(105, particles.get(5).id);
+  EXPECT_EQ(2.0f, particles.get(5).x);
+  EXPECT_EQ(0.0f, particles.get(5).y);
+
+  const auto& const_particles = particles;
+  auto alive = const_particles.column<&particle_t::alive>();
+  EXPECT_TRUE_STATIC(std::is_same_v<std::span<const bool>, decltype(alive)>);
+  EXPECT_EQ(0, std::ranges::count(alive, true));
+}
+
+TEST(TypeOperationsSoaVector, CopyAndMove)
+{
+  auto particles = rfl::soa_vector<particle_t>{};
+  for (auto i = 0; i < 20; i++) {
+    particles.push_back(make_particle(i));
+  }
+  auto copied = particles;
+  copied[3].tag = "changed";
+  EXPECT_EQ(20, copied.size());
+  EXPECT_EQ("p3", particles.get(3).tag);
+  EXPECT_EQ("changed", copied.get(3).tag);
+
+  auto moved = std::move(copied);
+  EXPECT_EQ(20, moved.size());
+  EXPECT_TRUE(copied.empty());
+  EXPECT_EQ("changed", moved.get(3).tag);
+
+  moved.resize(5);
+  EXPECT_EQ(5, moved.size());
+  moved.resize(8);
+  EXPECT_EQ("", moved.get(7).tag);
+  EXPECT_EQ(0, moved.get(7).id);
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+}
+
+TEST(TypeOperationsSoaVector, ExceptionSafety)
+{
+  auto values = rfl::soa_vector<guarded_t>{};
+  for (auto i = 0; i < 8; i++) {
+    values.push_back({.tag = std::string(32, 'a' + i), .fragile = {i}});
+  }
+  ASSERT_EQ(values.size(), values.capacity());
+
+  // Throws during reallocation: no element is lost
+  fragile_t::armed = true;
+  EXPECT_ANY_THROW(values.push_back({.tag = "new", .fragile = {8}}));
+  EXPECT_ANY_THROW(values.reserve(100));
+  fragile_t::armed = false;
+  EXPECT_EQ(8, values.size());
+  EXPECT_EQ(8, values.capacity());
+  for (auto i = 0; i < 8; i++) {
+    EXPECT_EQ(std::string(32, 'a' + i), values.get(i).tag);
+    EXPECT_EQ(i, values.get(i).fragile.value);
+  }
+
+  // Throws without reallocation
+  values.reserve(16);
+  fragile_t::armed = true;
+  EXPECT_ANY_THROW(values.push_back({.tag = "new", .fragile = {8}}));
+  fragile_t::armed = false;
+  EXPECT_EQ(8, values.size());
+  EXPECT_EQ(16, values.capacity());
+  EXPECT_EQ(std::string(32, 'h'), values.get(7).tag);
+}
@@ -0,0 +1,139 @@
+#include "tests/test_options.hpp"
+#include <array>
+#include <limits>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#ifdef ENABLE_FULL_HEADER_TEST
+#include <reflect_cpp26/annotations.hpp>
+#include <reflect_cpp26/type_operations.hpp>
+#else
+#include <reflect_cpp26/annotations/macros.h>
+#include <reflect_cpp26/type_operations/to_json.hpp>
+#endif
+
+#define RFL_PROPERTY(...) REFLECT_CPP26_PROPERTY(__VA_ARGS__)
+
+namespace rfl = reflect_cpp26;
+
+enum class severity : uint8_t {
+  debug, info, warning, error,
+};
+
+struct point_t {
+  int32_t x;
+  int32_t y;
+};
+
+struct header_t {
+  RFL_PROPERTY(rename, "ts")
+  int64_t timestamp;
+  severity level;
+};
+
+struct record_t : header_t {
+  RFL_PROPERTY(rename, "msg")
+  std::string message;
+  std::vector<point_t> path;
+  std::optional<uint32_t> code;
+  bool acked;
+};
+
+struct tagged_t {
+  RFL_PROPERTY(rename, "a\"b")
+  char tag[4];
+  char initial;
+};
+
+struct empty_t {};
+
+struct not_serializable_t {
+  int* ptr;
+};
+
+TEST(TypeOperationsToJson, Concept)
+{
+  EXPECT_TRUE_STATIC(rfl::json_serializable<const int>);
+  EXPECT_TRUE_STATIC(rfl::json_serializable<record_t>);
+  EXPECT_TRUE_STATIC(rfl::json_serializable<std::map<std::string, point_t>>);
+  EXPECT_FALSE_STATIC(rfl::json_serializable<int*>);
+  EXPECT_FALSE_STATIC(rfl::json_serializable<char16_t>);
+  EXPECT_FALSE_STATIC(rfl::json_serializable<not_serializable_t>);
+  EXPECT_FALSE_STATIC(
+    rfl::json_serializable<std::vector<not_serializable_t>>);
+}
+
+TEST(TypeOperationsToJson, Scalars)
+{
+  EXPECT_EQ_STATIC("null", rfl::to_json(nullptr));
+  EXPECT_EQ_STATIC("true", rfl::to_json(true));
+  EXPECT_EQ_STATIC("\"c\"", rfl::to_json('c'));
+  EXPECT_EQ_STATIC("-128", rfl::to_json(int8_t{-128}));
+  EXPECT_EQ_STATIC("18446744073709551615",
+    rfl::to_json(std::numeric_limits<uint64_t>::max()));
+  EXPECT_EQ_STATIC("\"warning\"", rfl::to_json(severity::warning));
+  EXPECT_EQ_STATIC("42", rfl::to_json(static_cast<severity>(42)));
+
+  EXPECT_EQ("0.1", rfl::to_json(0.1));
+  EXPECT_EQ("-2.5", rfl::to_json(-2.5f));
+  EXPECT_EQ("null", rfl::to_json(std::numeric_limits<double>::infinity()));
+  EXPECT_EQ("null", rfl::to_json(std::numeric_limits<float>::quiet_NaN()));
+}
+
+TEST(TypeOperationsToJson, Strings)
+{
+  EXPECT_EQ_STATIC("\"\"", rfl::to_json(std::string{}));
+  EXPECT_EQ_STATIC("\"abc\"", rfl::to_json("abc"));
+  EXPECT_EQ_STATIC(R"("a\"b\\c\n\t\u0001\u001f")",
+    rfl::to_json(std::string_view{"a\"b\\c\n\t\x01\x1f"}));
+  // UTF-8 is kept as is
+  EXPECT_EQ_STATIC("\"\xce\xb2\"", rfl::to_json(std::string{"\xce\xb2"}));
+}
+
+TEST(TypeOperationsToJson, Containers)
+{
+  EXPECT_EQ_STATIC("[]", rfl::to_json(std::vector<int>{}));
+  EXPECT_EQ_STATIC("[1,2,3]", rfl::to_json(std::array{1, 2, 3}));
+  EXPECT_EQ_STATIC("[1,\"x\",null]",
+    rfl::to_json(std::tuple{1, "x", std::optional<int>{}}));
+  EXPECT_EQ("[[\"a\",1],[\"b\",2]]",
+    rfl::to_json(std::map<std::string, int>{{"a", 1}, {"b", 2}}));
+}
+
+TEST(TypeOperationsToJson, Aggregates)
+{
+  EXPECT_EQ_STATIC("{}", rfl::to_json(empty_t{}));
+  EXPECT_EQ_STATIC(R"({"x":1,"y":-2})", rfl::to_json(point_t{1, -2}));
+  EXPECT_EQ_STATIC(R"({"a\"b":"ab","initial":"z"})",
+    rfl::to_json(tagged_t{.tag = {'a', 'b'}, .initial = 'z'}));
+
+  auto record = record_t{};
+  record.timestamp = 1700000000;
+  record.level = severity::error;
+  record.message = "disk \"sda\" full";
+  record.path = {{0, 0}, {3, 4}};
+  record.acked = false;
+  EXPECT_EQ(R"({"ts":1700000000,"level":"error","msg":"disk \"sda\" full",)"
+            R"("path":[{"x":0,"y":0},{"x":3,"y":4}],"code":null,)"
+            R"("acked":false})", rfl::to_json(record));
+
+  record.code = 404;
+  EXPECT_THAT(rfl::to_json(record), testing::HasSubstr(R"("code":404,)"));
+}
+
+TEST(TypeOperationsToJson, Append)
+{
+  auto buffer = std::string{"["};
+  rfl::append_json(buffer, point_t{1, 2});
+  buffer += ',';
+  rfl::append_json(buffer, point_t{3, 4});
+  buffer += ']';
+  EXPECT_EQ(R"([{"x":1,"y":2},{"x":3,"y":4}])", buffer);
+
+  // Reuses capacity of the same buffer
+  buffer.clear();
+  rfl::append_json(buffer, severity::info);
+  EXPECT_EQ("\"info\"", buffer);
+}
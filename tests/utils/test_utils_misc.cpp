@@ -2,7 +2,10 @@
 #include <reflect_cpp26/utils/ctype.hpp>
 #include <reflect_cpp26/utils/debug_helper.hpp>
 #include <reflect_cpp26/utils/meta_utility.hpp>
+#include <reflect_cpp26/utils/simd_find.hpp>
+#include <reflect_cpp26/utils/string_hash.hpp>
 #include <cctype>
+#include <vector>
 
 namespace rfl = reflect_cpp26;
 
@@ -78,3 +81,94 @@ TEST(UtilsMisc, MetaUtility)
   EXPECT_EQ_STATIC(2, obj.[:rfl::reflect_pointer_to_member(&C::b):]);
   EXPECT_EQ_STATIC(3, obj.[:rfl::reflect_pointer_to_member(&C::c):]);
 }
+
+template <class Hash>
+void test_string_hash_policy()
+{
+  // Compile-time and run-time results must be identical.
+#define MAKE_EXPECT_EQ(str, seed)                           \
+  do {                                                      \
+    constexpr auto expected = Hash::operator()(str, seed);  \
+    auto input = std::string{str};                          \
+    EXPECT_EQ(expected, Hash::operator()(input, seed))      \
+      << "Inconsistent hash value of '" << str << "'";      \
+  } while (false)
+
+  MAKE_EXPECT_EQ("", 0);
+  MAKE_EXPECT_EQ("a", 0);
+  MAKE_EXPECT_EQ("abcdefg", 1);
+  MAKE_EXPECT_EQ("abcdefgh", 2);
+  MAKE_EXPECT_EQ("abcdefghi", 3);
+  MAKE_EXPECT_EQ("medium_spring_green", 0);
+  MAKE_EXPECT_EQ("light_golden_rod_yellow", 12345);
+  MAKE_EXPECT_EQ("\x80\xff non-ASCII characters", 0xdead'beef'1234'5678);
+#undef MAKE_EXPECT_EQ
+
+  // Case-insensitive hash equals to hash of lower-case string.
+#define MAKE_EXPECT_EQ(str, lower_str, seed)                     \
+  do {                                                           \
+    constexpr auto expected = Hash::operator()(lower_str, seed); \
+    EXPECT_EQ_STATIC(expected, Hash::hash_icase(str, seed));     \
+    auto input = std::string{str};                               \
+    EXPECT_EQ(expected, Hash::hash_icase(input, seed))           \
+      << "Inconsistent icase hash value of '" << str << "'";     \
+  } while (false)
+
+  MAKE_EXPECT_EQ("", "", 0);
+  MAKE_EXPECT_EQ("A", "a", 0);
+  MAKE_EXPECT_EQ("AbCdEfGh", "abcdefgh", 2);
+  MAKE_EXPECT_EQ("Medium_Spring_GREEN", "medium_spring_green", 0);
+  MAKE_EXPECT_EQ("@[`{AZaz", "@[`{azaz", 7);
+  MAKE_EXPECT_EQ("\xc0\xdaX non-ASCII", "\xc0\xdax non-ascii", 1);
+#undef MAKE_EXPECT_EQ
+}
+
+TEST(UtilsMisc, StringHash)
+{
+  test_string_hash_policy<rfl::bkdr_hash_policy>();
+  test_string_hash_policy<rfl::wordwise_hash_policy>();
+  test_string_hash_policy<rfl::crc32c_hash_policy>();
+
+  EXPECT_EQ_STATIC(rfl::bkdr_hash64("hello"),
+    rfl::bkdr_hash_policy::operator()("hello", 42));
+  EXPECT_NE_STATIC(rfl::wordwise_hash_policy::operator()("hello", 0),
+    rfl::wordwise_hash_policy::operator()("hello", 1));
+  EXPECT_NE_STATIC(rfl::crc32c_hash_policy::operator()("hello", 0),
+    rfl::crc32c_hash_policy::operator()("hello", 1));
+
+  // CRC32C is affine over GF(2), thus seeds must be mixed nonlinearly
+  // to change collision patterns. The pair below collides with seed 0
+  // (found by Pollard's rho search), but not with seed 1.
+  using crc32c = rfl::crc32c_hash_policy;
+  EXPECT_EQ_STATIC(crc32c::operator()("bhnibdlefngncjfa", 0),
+    crc32c::operator()("niomgpdhacjiggib", 0));
+  EXPECT_NE_STATIC(crc32c::operator()("bhnibdlefngncjfa", 1),
+    crc32c::operator()("niomgpdhacjiggib", 1));
+}
+
+constexpr uint64_t simd_find_keys[] = {
+  3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9, 3, 2, 3, 8, 4, -1ull};
+
+TEST(UtilsMisc, SimdFind)
+{
+  EXPECT_EQ_STATIC(0zU, rfl::find_u64(simd_find_keys, 3));
+  EXPECT_EQ_STATIC(1zU, rfl::find_u64(simd_find_keys, 1));
+  EXPECT_EQ_STATIC(13zU, rfl::find_u64(simd_find_keys, 7));
+  EXPECT_EQ_STATIC(20zU, rfl::find_u64(simd_find_keys, -1ull));
+  EXPECT_EQ_STATIC(rfl::npos, rfl::find_u64(simd_find_keys, 0));
+  EXPECT_EQ_STATIC(rfl::npos, rfl::find_u64({}, 0));
+
+  // Run-time results (vectorized) must be identical to compile-time ones.
+  auto keys = std::vector<uint64_t>{};
+  for (auto n = 0zU; n <= 40; n++) {
+    for (auto key = 0zU; key <= n + 1; key++) {
+      auto expected = (key < n) ? key : rfl::npos;
+      EXPECT_EQ(expected, rfl::find_u64(keys, key)) << "n = " << n;
+    }
+    // Only the first occurrence is returned
+    keys.push_back(n);
+    keys.push_back(n);
+    EXPECT_EQ(n, rfl::find_u64(keys, n)) << "n = " << n;
+    keys.pop_back();
+  }
+}
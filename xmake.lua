@@ -49,7 +49,33 @@ meta_test_cases_with_custom_variants = {
     path = "tests/enum/test_enum_cast_from_string",
     variants = {
       { suffix = "_binary_search", defs = { "ENABLE_BINARY_SEARCH_CHECK" } },
-      { suffix = "_linear_search", defs = { "ENABLE_LINEAR_SEARCH_CHECK" } }
+      { suffix = "_linear_search", defs = { "ENABLE_LINEAR_SEARCH_CHECK" } },
+      { suffix = "_perfect_hash", defs = { "ENABLE_PERFECT_HASH_CHECK" } },
+      { suffix = "_wordwise_hash", defs = { "ENABLE_WORDWISE_HASH_CHECK" } },
+      { suffix = "_crc32c_hash", defs = { "ENABLE_CRC32C_HASH_CHECK" } },
+      { suffix = "_char_dispatch", defs = { "ENABLE_CHAR_DISPATCH_CHECK" } }
+    }
+  },
+  {
+    path = "tests/enum/test_enum_cast_batch",
+    variants = {
+      { suffix = "_binary_search", defs = { "ENABLE_BINARY_SEARCH_CHECK" } },
+      { suffix = "_perfect_hash", defs = { "ENABLE_PERFECT_HASH_CHECK" } }
+    }
+  },
+  {
+    path = "tests/enum/test_enum_cast_icase",
+    variants = {
+      { suffix = "_binary_search", defs = { "ENABLE_BINARY_SEARCH_CHECK" } },
+      { suffix = "_perfect_hash", defs = { "ENABLE_PERFECT_HASH_CHECK" } },
+      { suffix = "_wordwise_hash", defs = { "ENABLE_WORDWISE_HASH_CHECK" } },
+      { suffix = "_crc32c_hash", defs = { "ENABLE_CRC32C_HASH_CHECK" } }
+    }
+  },
+  {
+    path = "tests/enum/test_enum_switch",
+    variants = {
+      { suffix = "_jump_table", defs = { "ENABLE_SWITCH_JUMP_TABLE_CHECK" } }
     }
   }
 }
@@ -80,14 +106,22 @@ meta_test_cases_without_variant = {
   "tests/enum/test_enum_contains_string",
   "tests/enum/test_enum_count",
   "tests/enum/test_enum_entries",
+  "tests/enum/test_enum_flags",
   "tests/enum/test_enum_for_each",
+  "tests/enum/test_enum_fusion",
   "tests/enum/test_enum_hash",
   "tests/enum/test_enum_index",
   "tests/enum/test_enum_json_static",
   "tests/enum/test_enum_json",
+  "tests/enum/test_enum_large",
+  "tests/enum/test_enum_lookup_stats",
+  "tests/enum/test_enum_map",
   "tests/enum/test_enum_meta_entries",
   "tests/enum/test_enum_names",
-  "tests/enum/test_enum_switch",
+  "tests/enum/test_enum_parse_prefix",
+  "tests/enum/test_enum_search_strategy",
+  "tests/enum/test_enum_set",
+  "tests/enum/test_enum_to_chars",
   "tests/enum/test_enum_type_name",
   "tests/enum/test_enum_unique_count",
   "tests/enum/test_enum_unique_index",
@@ -97,8 +131,13 @@ meta_test_cases_without_variant = {
   "tests/lookup/test_namespace_lookup_table_by_enum",
   "tests/lookup/test_namespace_lookup_table_by_name",
   -- Type Operations
+  "tests/type_operations/test_binary_serialization",
+  "tests/type_operations/test_binary_view",
   "tests/type_operations/test_comparison",
   "tests/type_operations/test_define_aggregate",
+  "tests/type_operations/test_from_json",
+  "tests/type_operations/test_soa_vector",
+  "tests/type_operations/test_to_json",
   "tests/type_operations/test_to_structured",
   -- Annotations
   "tests/annotations/test_properties",
@@ -119,3 +158,31 @@ end
 for i, path in ipairs(meta_test_cases_without_variant) do
   make_test_case(path, "")
 end
+
+function make_benchmark(path)
+  local _, last_slash_index = string.find(path, ".*/")
+  local benchmark_group = string.sub(path, 1, last_slash_index - 1)
+  local benchmark_target_name = string.gsub(path, "/", "-")
+  local benchmark_src_file_path = path .. ".cpp"
+
+  target(benchmark_target_name, function ()
+    set_kind("binary")
+    set_group(benchmark_group)
+    add_files(benchmark_src_file_path)
+    set_languages("c++26")
+    set_optimize("fastest")
+    add_includedirs("include", ".")
+    add_cxxflags("-freflection-latest")
+  end)
+end
+
+benchmarks = {
+  -- Emits REFLECT_CPP26_ENUM_* threshold overrides tuned for the host CPU
+  "benchmarks/enum/enum_lookup_autotune",
+  -- Compares enum_switch by switch cases, jump table and compare chain
+  "benchmarks/enum/enum_switch",
+}
+
+for _, path in ipairs(benchmarks) do
+  make_benchmark(path)
+end